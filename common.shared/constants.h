@@ -53,6 +53,7 @@
 
 #define settings_mac_accounts_migrated "mac_accounts_migrated"
 #define settings_need_show_promo "need_show_promo"
+#define settings_avatars_cache_budget_mb "avatars_cache_budget_mb"
 
 #define settings_proxy_type "proxy_settings_type"
 #define settings_proxy_address "proxy_settings_address"
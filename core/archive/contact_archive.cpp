@@ -11,10 +11,10 @@
 using namespace core;
 using namespace archive;
 
-contact_archive::contact_archive(const std::wstring& _archive_path, const std::string& _contact_id)
+contact_archive::contact_archive(const std::wstring& _archive_path, const std::string& _contact_id, dlg_states_table& _states)
     : index_(new archive_index(_archive_path + L"/" + index_filename()))
     , data_(new messages_data(_archive_path + L"/" + db_filename()))
-    , state_(new archive_state(_archive_path + L"/" + dlg_state_filename(), _contact_id))
+    , state_(new archive_state(_archive_path + L"/" + dlg_state_filename(), _contact_id, _states))
     , images_(new image_cache(_archive_path + L"/" + image_cache_filename()))
     , path_(_archive_path)
     , local_loaded_(false)
@@ -390,6 +390,11 @@ std::wstring archive::dlg_state_filename()
     return L"_ste2";
 }
 
+std::wstring archive::dlg_states_table_filename()
+{
+    return L"_dlg_states";
+}
+
 std::wstring archive::image_cache_filename()
 {
     return L"_img3";
@@ -15,6 +15,7 @@ namespace core
         struct dlg_state_changes;
         class archive_hole;
         class archive_state;
+        class dlg_states_table;
         class image_cache;
         class image_data;
 
@@ -75,7 +76,7 @@ namespace core
 
             void delete_messages_up_to(const int64_t _up_to);
 
-            contact_archive(const std::wstring& _archive_path, const std::string& _contact_id);
+            contact_archive(const std::wstring& _archive_path, const std::string& _contact_id, dlg_states_table& _states);
             virtual ~contact_archive();
 
         };
@@ -83,6 +84,7 @@ namespace core
         std::wstring db_filename();
         std::wstring index_filename();
         std::wstring dlg_state_filename();
+        std::wstring dlg_states_table_filename();
         std::wstring image_cache_filename();
         std::wstring cache_filename();
     }
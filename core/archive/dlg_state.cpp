@@ -337,8 +337,265 @@ dlg_state_changes::dlg_state_changes()
 {
 }
 
-archive_state::archive_state(const std::wstring& _file_name, const std::string& _contact_id)
+//////////////////////////////////////////////////////////////////////////
+// dlg_states_table
+//////////////////////////////////////////////////////////////////////////
+enum dlg_states_table_fields
+{
+    dstf_contact = 1,
+    dstf_state = 2
+};
+
+namespace
+{
+    const size_t min_outdated_records_to_compact = 1000;
+}
+
+dlg_states_table::dlg_states_table(const std::wstring& _file_name)
     : storage_(new storage(_file_name))
+    , loaded_(false)
+    , need_compact_(false)
+    , records_count_(0)
+{
+}
+
+dlg_states_table::~dlg_states_table()
+{
+    flush();
+}
+
+void dlg_states_table::load()
+{
+    if (loaded_)
+        return;
+
+    loaded_ = true;
+
+    archive::storage_mode mode;
+    mode.flags_.read_ = true;
+
+    if (!storage_->open(mode))
+        return;
+
+    auto p_storage = storage_.get();
+    core::tools::auto_scope lb([p_storage]{p_storage->close();});
+
+    core::tools::binary_stream block_data;
+    while (storage_->read_data_block(-1, block_data))
+    {
+        core::tools::tlvpack block;
+        if (!block.unserialize(block_data))
+            break;
+
+        for (auto record = block.get_first(); record; record = block.get_next())
+        {
+            core::tools::tlvpack record_pack;
+            if (!record_pack.unserialize(record->get_value<core::tools::binary_stream>()))
+                continue;
+
+            auto tlv_contact = record_pack.get_item(dlg_states_table_fields::dstf_contact);
+            auto tlv_state = record_pack.get_item(dlg_states_table_fields::dstf_state);
+            if (!tlv_contact || !tlv_state)
+                continue;
+
+            auto state_data = tlv_state->get_value<core::tools::binary_stream>();
+
+            dlg_state state;
+            if (!state.unserialize(state_data))
+                continue;
+
+            states_[tlv_contact->get_value<std::string>()] = state;
+
+            ++records_count_;
+        }
+
+        block_data.reset();
+    }
+
+    // the blocks appended after a torn one would not be read
+    if (storage_->get_last_error() != archive::error::end_of_file)
+        need_compact_ = true;
+}
+
+dlg_state* dlg_states_table::find_state(const std::string& _contact)
+{
+    load();
+
+    auto iter = states_.find(_contact);
+    if (iter == states_.end())
+        return nullptr;
+
+    return &iter->second;
+}
+
+dlg_state& dlg_states_table::set_state(const std::string& _contact, const dlg_state& _state)
+{
+    load();
+
+    auto& state = states_[_contact];
+    state = _state;
+
+    changed_.insert(_contact);
+
+    return state;
+}
+
+void dlg_states_table::set_changed(const std::string& _contact)
+{
+    assert(states_.find(_contact) != states_.end());
+
+    changed_.insert(_contact);
+}
+
+bool dlg_states_table::write_records(storage& _storage, const std::vector<std::string>& _contacts)
+{
+    core::tools::tlvpack block;
+    size_t block_size = 0;
+
+    auto write_block = [&_storage, &block, &block_size]()
+    {
+        core::tools::binary_stream block_data;
+        block.serialize(block_data);
+
+        block = core::tools::tlvpack();
+        block_size = 0;
+
+        int64_t offset = 0;
+        return _storage.write_data_block(block_data, offset);
+    };
+
+    for (const auto& contact : _contacts)
+    {
+        auto iter = states_.find(contact);
+        if (iter == states_.end())
+            continue;
+
+        core::tools::binary_stream state_data;
+        iter->second.serialize(state_data);
+
+        core::tools::tlvpack record_pack;
+        record_pack.push_child(core::tools::tlv(dlg_states_table_fields::dstf_contact, iter->first));
+        record_pack.push_child(core::tools::tlv(dlg_states_table_fields::dstf_state, state_data));
+
+        core::tools::binary_stream record_data;
+        record_pack.serialize(record_data);
+
+        // the record tlv is its type and length followed by the data
+        const size_t record_size = (2 * sizeof(uint32_t) + record_data.available());
+        if (record_size > (size_t) max_data_block_size)
+        {
+            assert(!"dialog state does not fit a data block");
+            continue;
+        }
+
+        // a block is closed before it grows past what read_data_block accepts
+        if (block_size + record_size > (size_t) max_data_block_size)
+        {
+            if (!write_block())
+                return false;
+        }
+
+        block.push_child(core::tools::tlv((uint32_t) (block.size() + 1), record_data));
+        block_size += record_size;
+    }
+
+    if (!block.empty())
+        return write_block();
+
+    return true;
+}
+
+bool dlg_states_table::append_records(const std::vector<std::string>& _contacts)
+{
+    archive::storage_mode mode;
+    mode.flags_.write_ = true;
+    mode.flags_.append_ = true;
+
+    if (!storage_->open(mode))
+        return false;
+
+    auto p_storage = storage_.get();
+    core::tools::auto_scope lb([p_storage]{p_storage->close();});
+
+    return write_records(*storage_, _contacts);
+}
+
+bool dlg_states_table::write_compacted(const std::vector<std::string>& _contacts)
+{
+    // the table is written aside and then replaces the old file, a failed write keeps the old one
+    const auto file_name = storage_->get_file_name();
+    const auto temp_file_name = file_name + L".tmp";
+
+    {
+        storage temp_storage(temp_file_name);
+
+        archive::storage_mode mode;
+        mode.flags_.write_ = true;
+        mode.flags_.truncate_ = true;
+
+        if (!temp_storage.open(mode))
+            return false;
+
+        auto p_storage = &temp_storage;
+        core::tools::auto_scope lb([p_storage]{p_storage->close();});
+
+        if (!write_records(temp_storage, _contacts))
+            return false;
+    }
+
+    boost::system::error_code error;
+    boost::filesystem::rename(boost::filesystem::wpath(temp_file_name), boost::filesystem::wpath(file_name), error);
+
+    return !error;
+}
+
+bool dlg_states_table::flush()
+{
+    if (changed_.empty() && !need_compact_)
+        return true;
+
+    const auto compact = (need_compact_ || (records_count_ + changed_.size() > states_.size() * 2 + min_outdated_records_to_compact));
+
+    std::vector<std::string> contacts;
+
+    if (compact)
+    {
+        contacts.reserve(states_.size());
+        for (const auto& state : states_)
+            contacts.push_back(state.first);
+    }
+    else
+    {
+        contacts.assign(changed_.begin(), changed_.end());
+    }
+
+    __INFO(
+        "archive",
+        "flushing dialog states\n"
+        "    records=<%1%>\n"
+        "    compact=<%2%>",
+        contacts.size() % compact);
+
+    if (!(compact ? write_compacted(contacts) : append_records(contacts)))
+    {
+        need_compact_ = true;
+        return false;
+    }
+
+    records_count_ = (compact ? 0 : records_count_) + contacts.size();
+    need_compact_ = false;
+    changed_.clear();
+
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// archive_state
+//////////////////////////////////////////////////////////////////////////
+archive_state::archive_state(const std::wstring& _file_name, const std::string& _contact_id, dlg_states_table& _table)
+    : state_(nullptr)
+    , table_(_table)
+    , storage_(new storage(_file_name))
     , contact_id_(_contact_id)
 {
     assert(!contact_id_.empty());
@@ -357,12 +614,6 @@ bool archive_state::save()
         return false;
     }
 
-    archive::storage_mode mode;
-    mode.flags_.write_ = true;
-    mode.flags_.truncate_ = true;
-    if (!storage_->open(mode))
-        return false;
-
     __INFO(
         "delete_history",
         "serializing dialog state\n"
@@ -371,17 +622,13 @@ bool archive_state::save()
         "    del-up-to=<%3%>",
         contact_id_ % state_->get_history_patch_version() % state_->get_del_up_to());
 
-    auto p_storage = storage_.get();
-    core::tools::auto_scope lb([p_storage]{p_storage->close();});
-
-    core::tools::binary_stream block_data;
-    state_->serialize(block_data);
+    // written to the disk by the next flush of the table
+    table_.set_changed(contact_id_);
 
-    int64_t offset = 0;
-    return storage_->write_data_block(block_data, offset);
+    return true;
 }
 
-bool archive_state::load()
+bool archive_state::load(dlg_state& _state)
 {
     archive::storage_mode mode;
     mode.flags_.read_ = true;
@@ -396,16 +643,21 @@ bool archive_state::load()
     if (!storage_->read_data_block(-1, state_stream))
         return false;
 
-    return state_->unserialize(state_stream);
+    return _state.unserialize(state_stream);
 }
 
 const dlg_state& archive_state::get_state()
 {
     if (!state_)
     {
-        state_.reset(new dlg_state());
+        state_ = table_.find_state(contact_id_);
+        if (state_)
+            return *state_;
+
+        dlg_state loaded_state;
+        load(loaded_state);
 
-        load();
+        state_ = &table_.set_state(contact_id_, loaded_state);
 
         __INFO(
             "delete_history",
@@ -548,8 +800,8 @@ void archive_state::merge_state(const dlg_state& _new_state, Out dlg_state_chang
 
 void archive_state::set_state(const dlg_state& _state, Out archive::dlg_state_changes& _changes)
 {
-    if (!state_)
-        state_.reset(new dlg_state());
+    // the state kept in the table (or the legacy file) is merged into, a fresh one is made only when there is none
+    get_state();
 
     merge_state(_state, Out _changes);
 
@@ -558,8 +810,9 @@ void archive_state::set_state(const dlg_state& _state, Out archive::dlg_state_ch
 
 void archive_state::clear_state()
 {
-    if (state_)
-        *state_ = dlg_state();
+    get_state();
+
+    *state_ = dlg_state();
 
     save();
 }
@@ -130,17 +130,56 @@ namespace core
             bool last_message_changed_;
         };
 
+        // the dialog states of all the contacts of an account in one file, which is read once;
+        // the changed states are appended to it by flush() and the file is rewritten
+        // when it holds too many outdated records
+        class dlg_states_table
+        {
+            std::unordered_map<std::string, dlg_state> states_;
+            std::set<std::string> changed_;
+
+            std::unique_ptr<storage> storage_;
+
+            bool loaded_;
+            bool need_compact_;
+
+            // records in the file, the outdated ones included
+            size_t records_count_;
+
+            void load();
+
+            bool write_records(storage& _storage, const std::vector<std::string>& _contacts);
+            bool append_records(const std::vector<std::string>& _contacts);
+            bool write_compacted(const std::vector<std::string>& _contacts);
+
+        public:
+
+            dlg_states_table(const std::wstring& _file_name);
+            ~dlg_states_table();
+
+            dlg_state* find_state(const std::string& _contact);
+            dlg_state& set_state(const std::string& _contact, const dlg_state& _state);
+
+            void set_changed(const std::string& _contact);
+
+            bool flush();
+        };
+
         class archive_state
         {
-            std::unique_ptr<dlg_state>	state_;
+            // owned by the table
+            dlg_state*                  state_;
+            dlg_states_table&           table_;
+
+            // the state file of the versions without the table, read once if the table has no state
             std::unique_ptr<storage>	storage_;
             const std::string           contact_id_;
 
-            bool load();
+            bool load(dlg_state& _state);
 
         public:
 
-            archive_state(const std::wstring& _file_name, const std::string& _contact_id);
+            archive_state(const std::wstring& _file_name, const std::string& _contact_id, dlg_states_table& _table);
             ~archive_state();
 
             void merge_state(const dlg_state& _new_state, Out dlg_state_changes& _changes);
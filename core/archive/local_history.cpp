@@ -28,6 +28,14 @@ local_history::~local_history()
 {
 }
 
+dlg_states_table& local_history::get_dlg_states_table()
+{
+    if (!dlg_states_)
+        dlg_states_.reset(new dlg_states_table(archive_path_ + L"/" + dlg_states_table_filename()));
+
+    return *dlg_states_;
+}
+
 std::shared_ptr<contact_archive> local_history::get_contact_archive(const std::string& _contact)
 {
     // load contact archive, insert to map
@@ -38,7 +46,7 @@ std::shared_ptr<contact_archive> local_history::get_contact_archive(const std::s
 
     std::wstring contact_folder = core::tools::from_utf8(_contact);
     std::replace(contact_folder.begin(), contact_folder.end(), L'|', L'_');
-    auto contact_arch = std::make_shared<contact_archive>(archive_path_ + L"/" + contact_folder, _contact);
+    auto contact_arch = std::make_shared<contact_archive>(archive_path_ + L"/" + contact_folder, _contact, get_dlg_states_table());
 
     archives_.insert(std::make_pair(_contact, contact_arch));
 
@@ -119,10 +127,16 @@ void local_history::get_dlg_state(const std::string& _contact, dlg_state& _state
 
 void local_history::get_dlg_states(const std::vector<std::string>& _contacts, std::vector<dlg_state>& _states)
 {
-    for (auto iter : _contacts)
+    _states.reserve(_states.size() + _contacts.size());
+
+    for (const auto& contact : _contacts)
     {
-        auto state = get_contact_archive(iter)->get_dlg_state();
-        _states.push_back(state);
+        // the archive of the contact is opened only for a state the table has not got yet
+        const auto state = get_dlg_states_table().find_state(contact);
+        if (state)
+            _states.push_back(*state);
+        else
+            _states.push_back(get_contact_archive(contact)->get_dlg_state());
     }
 }
 
@@ -141,6 +155,11 @@ bool local_history::clear_dlg_state(const std::string& _contact)
     return true;
 }
 
+bool local_history::flush_dlg_states()
+{
+    return get_dlg_states_table().flush();
+}
+
 
 
 std::shared_ptr<archive_hole> local_history::get_next_hole(const std::string& _contact, int64_t _from, int64_t _depth)
@@ -637,6 +656,23 @@ std::shared_ptr<set_dlg_state_handler> face::set_dlg_state(const std::string& _c
 }
 
 
+std::shared_ptr<async_task_handlers> face::flush_dlg_states()
+{
+    auto handler = std::make_shared<async_task_handlers>();
+    auto history_cache = history_cache_;
+
+    thread_->run_async_function([history_cache]()->int32_t
+    {
+        return (history_cache->flush_dlg_states() ? 0 : -1);
+
+    })->on_result_ = [handler](int32_t _error)
+    {
+        handler->on_result_(_error);
+    };
+
+    return handler;
+}
+
 std::shared_ptr<async_task_handlers> face::clear_dlg_state(const std::string& _contact)
 {
     auto handler = std::make_shared<async_task_handlers>();
@@ -31,6 +31,7 @@ namespace core
         class message_header;
         class history_message;
         class dlg_state;
+        class dlg_states_table;
         struct dlg_state_changes;
         class archive_hole;
         class not_sent_message;
@@ -197,8 +198,10 @@ namespace core
             archives_map archives_;
             const std::wstring archive_path_;
             std::unique_ptr<not_sent_messages> not_sent_messages_;
+            std::unique_ptr<dlg_states_table> dlg_states_;
 
             std::shared_ptr<contact_archive> get_contact_archive(const std::string& _contact);
+            dlg_states_table& get_dlg_states_table();
 
             not_sent_messages& get_pending_messages();
 
@@ -223,6 +226,7 @@ namespace core
 
             void set_dlg_state(const std::string& _contact, const dlg_state& _state, Out dlg_state& _result, Out dlg_state_changes& _changes);
             bool clear_dlg_state(const std::string& _contact);
+            bool flush_dlg_states();
 
             std::shared_ptr<archive_hole> get_next_hole(const std::string& _contact, int64_t _from, int64_t _depth = -1);
             int64_t validate_hole_request(const std::string& _contact, const archive_hole& _hole_request, const int32_t _count);
@@ -290,6 +294,7 @@ namespace core
             
             std::shared_ptr<set_dlg_state_handler> set_dlg_state(const std::string& _contact, const dlg_state& _state);
             std::shared_ptr<async_task_handlers> clear_dlg_state(const std::string& _contact);
+            std::shared_ptr<async_task_handlers> flush_dlg_states();
             std::shared_ptr<request_next_hole_handler> get_next_hole(const std::string& _contact, int64_t _from, int64_t _depth = -1);
             std::shared_ptr<validate_hole_request_handler> validate_hole_request(const std::string& _contact, const archive_hole& _hole_request, const int32_t _count);
 
@@ -6,8 +6,6 @@
 using namespace core;
 using namespace archive;
 
-const int32_t max_data_block_size = (1024 * 1024);
-
 storage::storage(const std::wstring& _file_name)
     :	file_name_(_file_name), last_error_(archive::error::ok)
 {
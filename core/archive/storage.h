@@ -9,6 +9,9 @@ namespace core
 {
     namespace archive
     {
+        // read_data_block rejects larger blocks
+        const int32_t max_data_block_size = (1024 * 1024);
+
         class storage_data_block
         {
             core::tools::binary_stream	data_;
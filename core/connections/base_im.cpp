@@ -184,6 +184,11 @@ std::wstring base_im::get_snaps_storage_filename()
     return (get_im_data_path() + L"/" + L"snaps" + L"/" + L"cache");
 }
 
+std::wstring base_im::get_startup_snapshot_file_name()
+{
+    return (get_im_data_path() + L"/" + L"startup" + L"/" + archive::cache_filename());
+}
+
 // voip
 void core::base_im::on_voip_call_set_proxy(const voip_manager::VoipProxySettings& proxySettings) {
 #ifndef STRIP_VOIP
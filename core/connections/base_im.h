@@ -83,6 +83,7 @@ namespace core
         std::wstring get_im_downloads_path(const std::string &alt);
         std::wstring get_content_cache_path();
         std::wstring get_snaps_storage_filename();
+        std::wstring get_startup_snapshot_file_name();
 
         virtual std::string _get_protocol_uid() = 0;
         void set_id(int32_t _id);
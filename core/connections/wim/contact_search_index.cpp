@@ -0,0 +1,255 @@
+#include "stdafx.h"
+
+#include "contact_search_index.h"
+#include "../../tools/system.h"
+
+using namespace core;
+using namespace wim;
+
+namespace
+{
+    uint16_t make_bigram(const char _first, const char _second)
+    {
+        return (uint16_t) (((uint8_t) _first << 8) | (uint8_t) _second);
+    }
+
+    std::vector<uint32_t> intersect(const std::vector<uint32_t>& _first, const std::vector<uint32_t>& _second)
+    {
+        std::vector<uint32_t> result;
+        std::set_intersection(_first.begin(), _first.end(), _second.begin(), _second.end(), std::back_inserter(result));
+
+        return result;
+    }
+
+    std::vector<uint32_t> unite(const std::vector<uint32_t>& _first, const std::vector<uint32_t>& _second)
+    {
+        std::vector<uint32_t> result;
+        std::set_union(_first.begin(), _first.end(), _second.begin(), _second.end(), std::back_inserter(result));
+
+        return result;
+    }
+}
+
+std::vector<contact_search_index::bigram> contact_search_index::get_bigrams(const std::vector<std::string>& _words)
+{
+    std::vector<bigram> result;
+
+    for (const auto& word : _words)
+    {
+        for (size_t i = 1; i < word.size(); ++i)
+            result.push_back(make_bigram(word[i - 1], word[i]));
+    }
+
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+
+    return result;
+}
+
+void contact_search_index::index_slot(uint32_t _slot)
+{
+    for (auto bigram : get_bigrams(entries_[_slot].words_))
+    {
+        auto& slots = index_[bigram];
+        slots.insert(std::upper_bound(slots.begin(), slots.end(), _slot), _slot);
+    }
+}
+
+void contact_search_index::unindex_slot(uint32_t _slot)
+{
+    for (auto bigram : get_bigrams(entries_[_slot].words_))
+    {
+        auto iter = index_.find(bigram);
+        if (iter == index_.end())
+        {
+            assert(false);
+            continue;
+        }
+
+        auto& slots = iter->second;
+
+        auto iter_slot = std::lower_bound(slots.begin(), slots.end(), _slot);
+        if (iter_slot != slots.end() && *iter_slot == _slot)
+            slots.erase(iter_slot);
+
+        if (slots.empty())
+            index_.erase(iter);
+    }
+}
+
+contact_search_index::postings contact_search_index::all_slots() const
+{
+    postings result;
+    result.reserve(slots_.size());
+
+    for (uint32_t slot = 0; slot < (uint32_t) entries_.size(); ++slot)
+    {
+        if (!entries_[slot].is_empty())
+            result.push_back(slot);
+    }
+
+    return result;
+}
+
+contact_search_index::postings contact_search_index::find_substring(const std::string& _substring) const
+{
+    if (_substring.size() < 2)
+        return all_slots();
+
+    std::vector<const postings*> lists;
+
+    std::vector<std::string> words(1, _substring);
+    for (auto bigram : get_bigrams(words))
+    {
+        auto iter = index_.find(bigram);
+        if (iter == index_.end())
+            return postings();
+
+        lists.push_back(&iter->second);
+    }
+
+    // start from the rarest bigram, the intersection only shrinks
+    std::sort(lists.begin(), lists.end(), [](const postings* _first, const postings* _second)
+    {
+        return _first->size() < _second->size();
+    });
+
+    postings result = *lists.front();
+
+    for (size_t i = 1; i < lists.size() && !result.empty(); ++i)
+        result = intersect(result, *lists[i]);
+
+    return result;
+}
+
+contact_search_index::postings contact_search_index::sort_by_aimid(postings _slots) const
+{
+    std::sort(_slots.begin(), _slots.end(), [this](uint32_t _first, uint32_t _second)
+    {
+        return entries_[_first].aimid_ < entries_[_second].aimid_;
+    });
+
+    return _slots;
+}
+
+void contact_search_index::update(const std::string& _aimid, const std::string& _friendly, const std::string& _ab_name)
+{
+    std::vector<std::string> words;
+    words.reserve(3);
+    words.push_back(tools::system::to_upper(_friendly));
+    words.push_back(tools::system::to_upper(_ab_name));
+    words.push_back(tools::system::to_upper(_aimid));
+
+    auto iter = slots_.find(_aimid);
+    if (iter != slots_.end())
+    {
+        auto& current = entries_[iter->second];
+        if (current.words_ == words)
+            return;
+
+        unindex_slot(iter->second);
+        current.words_.swap(words);
+        index_slot(iter->second);
+
+        return;
+    }
+
+    uint32_t slot = 0;
+
+    if (!free_slots_.empty())
+    {
+        slot = free_slots_.back();
+        free_slots_.pop_back();
+    }
+    else
+    {
+        slot = (uint32_t) entries_.size();
+        entries_.emplace_back();
+    }
+
+    entries_[slot].aimid_ = _aimid;
+    entries_[slot].words_.swap(words);
+
+    slots_[_aimid] = slot;
+
+    index_slot(slot);
+}
+
+void contact_search_index::remove(const std::string& _aimid)
+{
+    auto iter = slots_.find(_aimid);
+    if (iter == slots_.end())
+        return;
+
+    const auto slot = iter->second;
+
+    unindex_slot(slot);
+
+    entries_[slot] = entry();
+    free_slots_.push_back(slot);
+
+    slots_.erase(iter);
+}
+
+void contact_search_index::clear()
+{
+    entries_.clear();
+    free_slots_.clear();
+    slots_.clear();
+    index_.clear();
+}
+
+size_t contact_search_index::size() const
+{
+    return slots_.size();
+}
+
+const contact_search_index::entry& contact_search_index::get_entry(uint32_t _slot) const
+{
+    assert(_slot < entries_.size());
+
+    return entries_[_slot];
+}
+
+contact_search_index::postings contact_search_index::find_candidates(const std::string& _pattern) const
+{
+    return sort_by_aimid(find_substring(_pattern));
+}
+
+contact_search_index::postings contact_search_index::find_candidates(const patterns_list& _patterns, unsigned _offset) const
+{
+    if (_patterns.empty())
+        return sort_by_aimid(all_slots());
+
+    if (_patterns.size() == 1)
+    {
+        postings result;
+
+        for (auto i = _offset; i < _patterns[0].size(); ++i)
+            result = unite(result, find_substring(_patterns[0][i]));
+
+        return sort_by_aimid(result);
+    }
+
+    // a match holds two neighbour symbols next to each other whatever spellings they have,
+    // so every pair of symbols narrows the candidates
+    postings result;
+
+    for (size_t symbol = 1; symbol < _patterns.size(); ++symbol)
+    {
+        postings pair_result;
+
+        for (auto i = _offset; i < _patterns[symbol - 1].size(); ++i)
+        {
+            for (auto j = _offset; j < _patterns[symbol].size(); ++j)
+                pair_result = unite(pair_result, find_substring(_patterns[symbol - 1][i] + _patterns[symbol][j]));
+        }
+
+        result = (symbol == 1 ? pair_result : intersect(result, pair_result));
+
+        if (result.empty())
+            break;
+    }
+
+    return sort_by_aimid(result);
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+namespace core
+{
+    namespace wim
+    {
+        // keeps the upper-cased names of the contacts together with a bigram index over them,
+        // so a search only looks at the contacts that have every bigram of the pattern
+        class contact_search_index
+        {
+        public:
+
+            typedef std::vector<std::vector<std::string>> patterns_list;
+            typedef std::vector<uint32_t> postings;
+
+            struct entry
+            {
+                std::string aimid_;
+
+                // upper-cased friendly name, address book name and aimid
+                std::vector<std::string> words_;
+
+                bool is_empty() const { return aimid_.empty(); }
+            };
+
+        private:
+
+            typedef uint16_t bigram;
+
+            std::vector<entry> entries_;
+            std::vector<uint32_t> free_slots_;
+
+            std::unordered_map<std::string, uint32_t> slots_;
+            std::unordered_map<bigram, postings> index_;
+
+            static std::vector<bigram> get_bigrams(const std::vector<std::string>& _words);
+
+            void index_slot(uint32_t _slot);
+            void unindex_slot(uint32_t _slot);
+
+            postings all_slots() const;
+            postings find_substring(const std::string& _substring) const;
+            postings sort_by_aimid(postings _slots) const;
+
+        public:
+
+            void update(const std::string& _aimid, const std::string& _friendly, const std::string& _ab_name);
+            void remove(const std::string& _aimid);
+            void clear();
+
+            size_t size() const;
+
+            const entry& get_entry(uint32_t _slot) const;
+
+            // slots of the contacts which words may contain _pattern, in aimid order;
+            // the caller checks the words of every candidate
+            postings find_candidates(const std::string& _pattern) const;
+
+            // the same for a translit pattern: every symbol has several spellings,
+            // the spellings below _offset are skipped like tools::contains does
+            postings find_candidates(const patterns_list& _patterns, unsigned _offset) const;
+        };
+    }
+}
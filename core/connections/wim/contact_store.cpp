@@ -0,0 +1,346 @@
+#include "stdafx.h"
+
+#include "contact_store.h"
+#include "wim_contactlist_cache.h"
+
+#include "../../../corelib/core_face.h"
+#include "../../../corelib/collection_helper.h"
+
+using namespace core;
+using namespace wim;
+
+namespace
+{
+    const size_t mask_capabilities_count = 64;
+
+    void add_string(rapidjson::Value& _node, const char* _name, const std::string& _value, rapidjson_allocator& _a)
+    {
+        rapidjson::Value value;
+        value.SetString(_value.c_str(), (rapidjson::SizeType) _value.length(), _a);
+
+        _node.AddMember(rapidjson::StringRef(_name), value, _a);
+    }
+}
+
+const contact_store::slot contact_store::invalid_slot;
+
+contact_store::string_pool::string_pool()
+{
+    strings_.emplace_back();
+    ids_[std::string()] = 0;
+}
+
+uint16_t contact_store::string_pool::intern(const std::string& _value)
+{
+    auto iter = ids_.find(_value);
+    if (iter != ids_.end())
+        return iter->second;
+
+    if (strings_.size() > std::numeric_limits<uint16_t>::max())
+    {
+        assert(!"string pool is full");
+        return 0;
+    }
+
+    const auto id = (uint16_t) strings_.size();
+
+    strings_.push_back(_value);
+    ids_[_value] = id;
+
+    return id;
+}
+
+const std::string& contact_store::string_pool::get(uint16_t _id) const
+{
+    assert(_id < strings_.size());
+
+    return strings_[_id];
+}
+
+size_t contact_store::string_pool::size() const
+{
+    return strings_.size();
+}
+
+uint64_t contact_store::make_capabilities(slot _slot, const std::set<std::string>& _capabilities)
+{
+    uint64_t mask = 0;
+
+    extra_capabilities_.erase(_slot);
+
+    for (const auto& capability : _capabilities)
+    {
+        const auto id = capabilities_pool_.intern(capability);
+        if (id == 0)
+            continue;
+
+        if (id <= mask_capabilities_count)
+            mask |= ((uint64_t) 1 << (id - 1));
+        else
+            extra_capabilities_[_slot].insert(capability);
+    }
+
+    return mask;
+}
+
+std::set<std::string> contact_store::get_capabilities(slot _slot) const
+{
+    std::set<std::string> result;
+
+    const auto mask = capabilities_[_slot];
+
+    for (size_t bit = 0; bit < mask_capabilities_count && (mask >> bit) != 0; ++bit)
+    {
+        if (mask & ((uint64_t) 1 << bit))
+            result.insert(capabilities_pool_.get((uint16_t) (bit + 1)));
+    }
+
+    auto iter_extra = extra_capabilities_.find(_slot);
+    if (iter_extra != extra_capabilities_.end())
+        result.insert(iter_extra->second.begin(), iter_extra->second.end());
+
+    return result;
+}
+
+bool contact_store::has_flag(slot _slot, contact_flags _flag) const
+{
+    return ((flags_[_slot] & _flag) != 0);
+}
+
+contact_store::slot contact_store::find(const std::string& _aimid) const
+{
+    auto iter = slots_.find(_aimid);
+    if (iter == slots_.end())
+        return invalid_slot;
+
+    return iter->second;
+}
+
+contact_store::slot contact_store::insert(const std::string& _aimid)
+{
+    auto iter = slots_.find(_aimid);
+    if (iter != slots_.end())
+        return iter->second;
+
+    slot new_slot = 0;
+
+    if (!free_slots_.empty())
+    {
+        new_slot = free_slots_.back();
+        free_slots_.pop_back();
+    }
+    else
+    {
+        new_slot = (slot) aimids_.size();
+
+        aimids_.emplace_back();
+        friendly_.emplace_back();
+        ab_names_.emplace_back();
+        status_msgs_.emplace_back();
+        other_numbers_.emplace_back();
+        icon_ids_.emplace_back();
+        big_icon_ids_.emplace_back();
+        large_icon_ids_.emplace_back();
+
+        states_.push_back(0);
+        usertypes_.push_back(0);
+        capabilities_.push_back(0);
+        lastseen_.push_back(-1);
+        flags_.push_back(0);
+    }
+
+    aimids_[new_slot] = _aimid;
+
+    slots_[_aimid] = new_slot;
+
+    return new_slot;
+}
+
+void contact_store::remove(const std::string& _aimid)
+{
+    auto iter = slots_.find(_aimid);
+    if (iter == slots_.end())
+        return;
+
+    const auto removed = iter->second;
+
+    std::string().swap(aimids_[removed]);
+    std::string().swap(friendly_[removed]);
+    std::string().swap(ab_names_[removed]);
+    std::string().swap(status_msgs_[removed]);
+    std::string().swap(other_numbers_[removed]);
+    std::string().swap(icon_ids_[removed]);
+    std::string().swap(big_icon_ids_[removed]);
+    std::string().swap(large_icon_ids_[removed]);
+
+    states_[removed] = 0;
+    usertypes_[removed] = 0;
+    capabilities_[removed] = 0;
+    lastseen_[removed] = -1;
+    flags_[removed] = 0;
+
+    extra_capabilities_.erase(removed);
+
+    free_slots_.push_back(removed);
+    slots_.erase(iter);
+}
+
+void contact_store::clear()
+{
+    *this = contact_store();
+}
+
+size_t contact_store::size() const
+{
+    return slots_.size();
+}
+
+std::vector<std::string> contact_store::get_aimids() const
+{
+    std::vector<std::string> result;
+    result.reserve(slots_.size());
+
+    for (const auto& aimid : aimids_)
+    {
+        if (!aimid.empty())
+            result.push_back(aimid);
+    }
+
+    return result;
+}
+
+const std::string& contact_store::get_aimid(slot _slot) const
+{
+    return aimids_[_slot];
+}
+
+const std::string& contact_store::get_friendly(slot _slot) const
+{
+    return friendly_[_slot];
+}
+
+const std::string& contact_store::get_ab_name(slot _slot) const
+{
+    return ab_names_[_slot];
+}
+
+const std::string& contact_store::get_usertype(slot _slot) const
+{
+    return usertypes_pool_.get(usertypes_[_slot]);
+}
+
+const std::string& contact_store::get_large_icon_id(slot _slot) const
+{
+    return large_icon_ids_[_slot];
+}
+
+cl_presence contact_store::get_presence(slot _slot) const
+{
+    cl_presence presence;
+
+    presence.state_ = states_pool_.get(states_[_slot]);
+    presence.usertype_ = usertypes_pool_.get(usertypes_[_slot]);
+    presence.status_msg_ = status_msgs_[_slot];
+    presence.other_number_ = other_numbers_[_slot];
+    presence.capabilities_ = get_capabilities(_slot);
+    presence.ab_contact_name_ = ab_names_[_slot];
+    presence.friendly_ = friendly_[_slot];
+    presence.lastseen_ = lastseen_[_slot];
+    presence.is_chat_ = has_flag(_slot, cf_chat);
+    presence.muted_ = has_flag(_slot, cf_muted);
+    presence.is_live_chat_ = has_flag(_slot, cf_live_chat);
+    presence.official_ = has_flag(_slot, cf_official);
+    presence.icon_id_ = icon_ids_[_slot];
+    presence.big_icon_id_ = big_icon_ids_[_slot];
+    presence.large_icon_id_ = large_icon_ids_[_slot];
+
+    return presence;
+}
+
+void contact_store::set_presence(slot _slot, const cl_presence& _presence)
+{
+    assert(_slot < aimids_.size());
+
+    friendly_[_slot] = _presence.friendly_;
+    ab_names_[_slot] = _presence.ab_contact_name_;
+    status_msgs_[_slot] = _presence.status_msg_;
+    other_numbers_[_slot] = _presence.other_number_;
+    icon_ids_[_slot] = _presence.icon_id_;
+    big_icon_ids_[_slot] = _presence.big_icon_id_;
+    large_icon_ids_[_slot] = _presence.large_icon_id_;
+
+    states_[_slot] = states_pool_.intern(_presence.state_);
+    usertypes_[_slot] = usertypes_pool_.intern(_presence.usertype_);
+    capabilities_[_slot] = make_capabilities(_slot, _presence.capabilities_);
+    lastseen_[_slot] = _presence.lastseen_;
+
+    uint8_t flags = 0;
+    if (_presence.is_chat_)
+        flags |= cf_chat;
+    if (_presence.muted_)
+        flags |= cf_muted;
+    if (_presence.is_live_chat_)
+        flags |= cf_live_chat;
+    if (_presence.official_)
+        flags |= cf_official;
+
+    flags_[_slot] = flags;
+}
+
+void contact_store::set_chat(slot _slot)
+{
+    flags_[_slot] |= cf_chat;
+}
+
+void contact_store::serialize(slot _slot, icollection* _coll) const
+{
+    coll_helper cl(_coll, false);
+    cl.set_value_as_string("aimId", aimids_[_slot]);
+    cl.set_value_as_string("state", states_pool_.get(states_[_slot]));
+    cl.set_value_as_string("userType", usertypes_pool_.get(usertypes_[_slot]));
+    cl.set_value_as_string("statusMsg", status_msgs_[_slot]);
+    cl.set_value_as_string("otherNumber", other_numbers_[_slot]);
+    cl.set_value_as_string("friendly", friendly_[_slot]);
+    cl.set_value_as_string("abContactName", ab_names_[_slot]);
+    cl.set_value_as_bool("is_chat", has_flag(_slot, cf_chat));
+    cl.set_value_as_bool("mute", has_flag(_slot, cf_muted));
+    cl.set_value_as_bool("official", has_flag(_slot, cf_official));
+    cl.set_value_as_int("lastseen", lastseen_[_slot]);
+    cl.set_value_as_bool("livechat", has_flag(_slot, cf_live_chat));
+    cl.set_value_as_string("iconId", icon_ids_[_slot]);
+    cl.set_value_as_string("bigIconId", big_icon_ids_[_slot]);
+    cl.set_value_as_string("largeIconId", large_icon_ids_[_slot]);
+}
+
+void contact_store::serialize(slot _slot, rapidjson::Value& _node, rapidjson_allocator& _a) const
+{
+    add_string(_node, "aimId", aimids_[_slot], _a);
+    add_string(_node, "state", states_pool_.get(states_[_slot]), _a);
+    add_string(_node, "userType", usertypes_pool_.get(usertypes_[_slot]), _a);
+    add_string(_node, "statusMsg", status_msgs_[_slot], _a);
+    add_string(_node, "otherNumber", other_numbers_[_slot], _a);
+    add_string(_node, "friendly", friendly_[_slot], _a);
+    add_string(_node, "abContactName", ab_names_[_slot], _a);
+    _node.AddMember("lastseen", lastseen_[_slot], _a);
+    _node.AddMember("mute", has_flag(_slot, cf_muted), _a);
+    _node.AddMember("livechat", has_flag(_slot, cf_live_chat) ? 1 : 0, _a);
+    _node.AddMember("official", has_flag(_slot, cf_official) ? 1 : 0, _a);
+    add_string(_node, "iconId", icon_ids_[_slot], _a);
+    add_string(_node, "bigIconId", big_icon_ids_[_slot], _a);
+    add_string(_node, "largeIconId", large_icon_ids_[_slot], _a);
+
+    const auto capabilities = get_capabilities(_slot);
+    if (!capabilities.empty())
+    {
+        rapidjson::Value node_capabilities(rapidjson::Type::kArrayType);
+        for (const auto& capability : capabilities)
+        {
+            rapidjson::Value capa;
+            capa.SetString(capability.c_str(), (rapidjson::SizeType) capability.length(), _a);
+
+            node_capabilities.PushBack(capa, _a);
+        }
+
+        _node.AddMember("capabilities", node_capabilities, _a);
+    }
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+namespace core
+{
+    struct icollection;
+
+    namespace wim
+    {
+        struct cl_presence;
+
+        // the contacts of a contact list kept column by column: the strings of a contact are stored as they are,
+        // the few distinct states and user types are interned, the capabilities are the bits of a mask;
+        // a contact is addressed by its slot, the slots of the removed contacts are reused
+        class contact_store
+        {
+        public:
+
+            typedef uint32_t slot;
+
+            static const slot invalid_slot = (slot) -1;
+
+        private:
+
+            enum contact_flags
+            {
+                cf_chat = 0x1,
+                cf_muted = 0x2,
+                cf_live_chat = 0x4,
+                cf_official = 0x8
+            };
+
+            // ids of the distinct strings, 0 is the empty string
+            class string_pool
+            {
+                std::vector<std::string> strings_;
+                std::unordered_map<std::string, uint16_t> ids_;
+
+            public:
+
+                string_pool();
+
+                uint16_t intern(const std::string& _value);
+                const std::string& get(uint16_t _id) const;
+
+                size_t size() const;
+            };
+
+            std::vector<std::string> aimids_;
+            std::vector<std::string> friendly_;
+            std::vector<std::string> ab_names_;
+            std::vector<std::string> status_msgs_;
+            std::vector<std::string> other_numbers_;
+            std::vector<std::string> icon_ids_;
+            std::vector<std::string> big_icon_ids_;
+            std::vector<std::string> large_icon_ids_;
+
+            std::vector<uint16_t> states_;
+            std::vector<uint16_t> usertypes_;
+            std::vector<uint64_t> capabilities_;
+            std::vector<int32_t> lastseen_;
+            std::vector<uint8_t> flags_;
+
+            std::vector<slot> free_slots_;
+            std::unordered_map<std::string, slot> slots_;
+
+            string_pool states_pool_;
+            string_pool usertypes_pool_;
+
+            // a bit of the mask per capability, the capabilities past the 64th are kept by slot
+            string_pool capabilities_pool_;
+            std::unordered_map<slot, std::set<std::string>> extra_capabilities_;
+
+            uint64_t make_capabilities(slot _slot, const std::set<std::string>& _capabilities);
+            std::set<std::string> get_capabilities(slot _slot) const;
+
+            bool has_flag(slot _slot, contact_flags _flag) const;
+
+        public:
+
+            slot find(const std::string& _aimid) const;
+
+            // the slot of the contact, a new one is added with the default presence
+            slot insert(const std::string& _aimid);
+
+            void remove(const std::string& _aimid);
+
+            void clear();
+
+            size_t size() const;
+
+            std::vector<std::string> get_aimids() const;
+
+            const std::string& get_aimid(slot _slot) const;
+            const std::string& get_friendly(slot _slot) const;
+            const std::string& get_ab_name(slot _slot) const;
+            const std::string& get_usertype(slot _slot) const;
+            const std::string& get_large_icon_id(slot _slot) const;
+
+            cl_presence get_presence(slot _slot) const;
+            void set_presence(slot _slot, const cl_presence& _presence);
+            void set_chat(slot _slot);
+
+            void serialize(slot _slot, icollection* _coll) const;
+            void serialize(slot _slot, rapidjson::Value& _node, rapidjson_allocator& _a) const;
+        };
+    }
+}
@@ -75,6 +75,151 @@ namespace core
                 }
 
             };
+
+            struct scheduler_progress
+            {
+                // chains added, started and finished since the start
+                uint32_t added_;
+                uint32_t started_;
+                uint32_t finished_;
+
+                scheduler_progress() : added_(0), started_(0), finished_(0) {}
+            };
+
+            // runs the holes downloading chains of several contacts in parallel, at most one chain per contact;
+            // the caller ranks the contacts, a lower rank is started first, and the reserved slots are
+            // kept for rank 0 (the opened dialogs), so they never wait for the background chains
+            class scheduler
+            {
+            public:
+
+                typedef std::function<void(int64_t)> last_message_catcher_t;
+
+                struct chain_request
+                {
+                    holes::request request_;
+                    last_message_catcher_t last_message_catcher_;
+                    uint64_t seq_;
+
+                    chain_request(const holes::request& _request, last_message_catcher_t _last_message_catcher, uint64_t _seq)
+                        :   request_(_request),
+                            last_message_catcher_(_last_message_catcher),
+                            seq_(_seq)
+                    {
+                    }
+                };
+
+            private:
+
+                std::map<std::string, chain_request> pending_;
+                std::set<std::string> running_;
+
+                uint32_t max_running_;
+                uint32_t reserved_running_;
+                uint64_t seq_;
+
+                scheduler_progress progress_;
+
+            public:
+
+                scheduler(uint32_t _max_running, uint32_t _reserved_running)
+                    :   max_running_(_max_running),
+                        reserved_running_(_reserved_running),
+                        seq_(0)
+                {
+                }
+
+                void add(const holes::request& _request, last_message_catcher_t _last_message_catcher)
+                {
+                    ++progress_.added_;
+
+                    auto iter = pending_.find(_request.get_contact());
+                    if (iter == pending_.end())
+                    {
+                        pending_.insert(std::make_pair(_request.get_contact(), chain_request(_request, _last_message_catcher, ++seq_)));
+                        return;
+                    }
+
+                    // two different requests of one contact are merged into the whole dialog check, as failed_requests does
+                    auto& pending = iter->second;
+
+                    if (pending.request_.get_from() != _request.get_from() || pending.request_.get_depth() != _request.get_depth())
+                    {
+                        pending.request_.set_from(-1);
+                        pending.request_.set_depth(-1);
+                        pending.request_.set_recursion(-1);
+                    }
+
+                    auto first_catcher = pending.last_message_catcher_;
+                    pending.last_message_catcher_ = [first_catcher, _last_message_catcher](int64_t _id)
+                    {
+                        first_catcher(_id);
+                        _last_message_catcher(_id);
+                    };
+                }
+
+                bool can_start() const
+                {
+                    return (running_.size() < (max_running_ + reserved_running_) && pending_.size() > 0);
+                }
+
+                std::shared_ptr<chain_request> get_next(std::function<int32_t(const std::string&)> _rank)
+                {
+                    std::shared_ptr<chain_request> next;
+
+                    if (running_.size() >= (max_running_ + reserved_running_))
+                        return next;
+
+                    auto next_iter = pending_.end();
+                    int32_t next_rank = 0;
+
+                    for (auto iter = pending_.begin(); iter != pending_.end(); ++iter)
+                    {
+                        if (running_.find(iter->first) != running_.end())
+                            continue;
+
+                        const auto rank = _rank(iter->first);
+
+                        if (next_iter == pending_.end() || rank < next_rank || (rank == next_rank && iter->second.seq_ < next_iter->second.seq_))
+                        {
+                            next_iter = iter;
+                            next_rank = rank;
+                        }
+                    }
+
+                    if (next_iter == pending_.end())
+                        return next;
+
+                    if (running_.size() >= max_running_ && next_rank > 0)
+                        return next;
+
+                    next = std::make_shared<chain_request>(next_iter->second);
+
+                    running_.insert(next_iter->first);
+                    pending_.erase(next_iter);
+
+                    ++progress_.started_;
+
+                    return next;
+                }
+
+                void on_finished(const std::string& _contact)
+                {
+                    running_.erase(_contact);
+
+                    ++progress_.finished_;
+                }
+
+                bool is_idle() const
+                {
+                    return (pending_.empty() && running_.empty());
+                }
+
+                const scheduler_progress& get_progress() const { return progress_; }
+
+                uint32_t get_pending_count() const { return (uint32_t) pending_.size(); }
+                uint32_t get_running_count() const { return (uint32_t) running_.size(); }
+            };
         }
     }
 }
@@ -29,6 +29,72 @@ using namespace wim;
 
 const auto default_fetch_timeout = std::chrono::milliseconds(500);
 
+namespace
+{
+    const auto default_long_poll_timeout = std::chrono::milliseconds(60000);
+    const auto max_long_poll_timeout = std::chrono::milliseconds(90000);
+
+    // a burst of events is worth a short pause, the next response carries several of them
+    const double busy_events_rate = 2.0;
+    const auto busy_fetch_delay = std::chrono::milliseconds(200);
+
+    const double events_rate_weight = 0.3;
+}
+
+fetch_pacer::fetch_pacer()
+    : timeout_(default_long_poll_timeout)
+    , events_rate_(0)
+    , last_fetch_time_(std::chrono::system_clock::now())
+{
+}
+
+std::chrono::milliseconds fetch_pacer::get_timeout() const
+{
+    return timeout_;
+}
+
+std::chrono::milliseconds fetch_pacer::get_delay() const
+{
+    if (events_rate_ >= busy_events_rate)
+        return busy_fetch_delay;
+
+    return std::chrono::milliseconds(0);
+}
+
+void fetch_pacer::on_fetched(const size_t _events_count, const bool _is_long_poll)
+{
+    const auto current_time = std::chrono::system_clock::now();
+
+    const auto elapsed_ms = std::max<int64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(current_time - last_fetch_time_).count(), 50);
+
+    last_fetch_time_ = current_time;
+
+    const double rate = (double) _events_count * 1000.0 / (double) elapsed_ms;
+
+    events_rate_ = events_rate_weight * rate + (1.0 - events_rate_weight) * events_rate_;
+
+    // the conversation is active again, get back to the default poll
+    if (_events_count != 0)
+    {
+        timeout_ = default_long_poll_timeout;
+        return;
+    }
+
+    if (!_is_long_poll)
+        return;
+
+    // nothing happened for the whole poll, the next one may wait longer
+    timeout_ = std::min(max_long_poll_timeout, timeout_ * 3 / 2);
+}
+
+void fetch_pacer::on_network_error()
+{
+    // a proxy or a NAT may have dropped the longer poll
+    timeout_ = default_long_poll_timeout;
+    events_rate_ = 0;
+    last_fetch_time_ = std::chrono::system_clock::now();
+}
+
 fetch::fetch(
     const wim_packet_params& _params,
     const std::string& _fetch_url,
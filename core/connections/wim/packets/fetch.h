@@ -13,6 +13,28 @@ namespace core
     {
         class fetch_event;
 
+        // chooses the long-poll timeout and the pause between the fetches from the recent events:
+        // a quiet connection polls longer, a burst of events is collected into fewer responses
+        class fetch_pacer
+        {
+            std::chrono::milliseconds timeout_;
+
+            // exponential moving average of the events per second
+            double events_rate_;
+
+            timepoint last_fetch_time_;
+
+        public:
+
+            fetch_pacer();
+
+            std::chrono::milliseconds get_timeout() const;
+            std::chrono::milliseconds get_delay() const;
+
+            void on_fetched(const size_t _events_count, const bool _is_long_poll);
+            void on_network_error();
+        };
+
         class fetch : public wim_packet
         {
             std::string fetch_url_;
@@ -40,6 +62,7 @@ namespace core
             const time_t get_ts() const { return ts_; }
             const time_t get_time_offset() const { return time_offset_; }
             bool is_session_ended() const;
+            size_t get_events_count() const { return events_.size(); }
 
             std::shared_ptr<core::wim::fetch_event> push_event(std::shared_ptr<core::wim::fetch_event> _event);
             std::shared_ptr<core::wim::fetch_event> pop_event();
@@ -37,6 +37,11 @@ send_message::~send_message()
 
 }
 
+std::string send_message::get_send_queue() const
+{
+    return "contact/" + aimid_;
+}
+
 int32_t send_message::init_request(std::shared_ptr<core::http_request_simple> _request)
 {
     std::string method;
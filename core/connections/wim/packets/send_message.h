@@ -74,6 +74,9 @@ namespace core
                 const core::archive::quotes_vec& _quotes);
 
             virtual ~send_message();
+
+            // messages of one contact are sent in order, different contacts in parallel
+            virtual std::string get_send_queue() const override;
         };
 
     }
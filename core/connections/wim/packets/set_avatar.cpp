@@ -19,6 +19,12 @@ set_avatar::~set_avatar()
 {
 }
 
+std::string set_avatar::get_send_queue() const
+{
+    // a big upload, must not hold the messages
+    return "avatar";
+}
+
 int32_t set_avatar::init_request(std::shared_ptr<core::http_request_simple> _request)
 {
     std::stringstream ss_url;
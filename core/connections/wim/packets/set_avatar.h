@@ -32,6 +32,8 @@ namespace core
         public:
             set_avatar(const wim_packet_params& _params, tools::binary_stream _image, const std::string& _aimId, const bool _chat);
             virtual ~set_avatar();
+
+            virtual std::string get_send_queue() const override;
             
             inline const std::string &get_id() const { return id_; }
         };
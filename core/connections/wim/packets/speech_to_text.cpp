@@ -24,6 +24,11 @@ speech_to_text::~speech_to_text()
 {
 }
 
+std::string speech_to_text::get_send_queue() const
+{
+    return "speech_to_text";
+}
+
 
 int32_t speech_to_text::init_request(std::shared_ptr<core::http_request_simple> _request)
 {
@@ -37,6 +37,8 @@ namespace core
 
             virtual ~speech_to_text();
 
+            virtual std::string get_send_queue() const override;
+
             std::string get_text() const;
             int32_t get_comeback() const;
         };
@@ -0,0 +1,179 @@
+#include "stdafx.h"
+
+#include "startup_snapshot.h"
+
+using namespace core;
+using namespace wim;
+
+enum startup_snapshot_fields
+{
+    ssf_contact_list = 1,
+    ssf_recents = 2,
+
+    ssf_aimid = 1,
+    ssf_state = 2
+};
+
+namespace
+{
+    // the first screens of the recents, the newest first; the rest comes with the archive
+    const size_t max_recents_count = 100;
+}
+
+startup_snapshot::startup_snapshot()
+    : changed_(false)
+{
+}
+
+bool startup_snapshot::is_changed() const
+{
+    return changed_;
+}
+
+void startup_snapshot::set_changed(bool _changed)
+{
+    changed_ = _changed;
+}
+
+void startup_snapshot::set_contact_list(const std::string& _json)
+{
+    contact_list_ = _json;
+
+    changed_ = true;
+}
+
+const std::string& startup_snapshot::get_contact_list() const
+{
+    return contact_list_;
+}
+
+void startup_snapshot::set_recents(std::vector<std::string> _recents)
+{
+    if (_recents.size() > max_recents_count)
+        _recents.resize(max_recents_count);
+
+    if (_recents == recents_)
+        return;
+
+    recents_.swap(_recents);
+
+    const std::unordered_set<std::string> recents(recents_.begin(), recents_.end());
+
+    for (auto iter = states_.begin(); iter != states_.end();)
+    {
+        if (recents.find(iter->first) == recents.end())
+            iter = states_.erase(iter);
+        else
+            ++iter;
+    }
+
+    changed_ = true;
+}
+
+const std::vector<std::string>& startup_snapshot::get_recents() const
+{
+    return recents_;
+}
+
+void startup_snapshot::update_state(const std::string& _aimid, const archive::dlg_state& _state)
+{
+    states_[_aimid] = _state;
+
+    // the states of the other dialogs are kept until the recents are known and then dropped
+    if (std::find(recents_.begin(), recents_.end(), _aimid) != recents_.end())
+        changed_ = true;
+}
+
+const archive::dlg_state* startup_snapshot::get_state(const std::string& _aimid) const
+{
+    auto iter = states_.find(_aimid);
+    if (iter == states_.end())
+        return nullptr;
+
+    return &iter->second;
+}
+
+void startup_snapshot::serialize(core::tools::binary_stream& _data) const
+{
+    core::tools::tlvpack pack;
+
+    pack.push_child(core::tools::tlv(startup_snapshot_fields::ssf_contact_list, contact_list_));
+
+    core::tools::tlvpack recents_pack;
+
+    uint32_t counter = 0;
+
+    for (const auto& aimid : recents_)
+    {
+        auto iter = states_.find(aimid);
+        if (iter == states_.end())
+            continue;
+
+        core::tools::binary_stream state_data;
+        iter->second.serialize(state_data);
+
+        core::tools::tlvpack record_pack;
+        record_pack.push_child(core::tools::tlv(startup_snapshot_fields::ssf_aimid, aimid));
+        record_pack.push_child(core::tools::tlv(startup_snapshot_fields::ssf_state, state_data));
+
+        core::tools::binary_stream record_data;
+        record_pack.serialize(record_data);
+
+        recents_pack.push_child(core::tools::tlv(++counter, record_data));
+    }
+
+    core::tools::binary_stream recents_data;
+    recents_pack.serialize(recents_data);
+
+    pack.push_child(core::tools::tlv(startup_snapshot_fields::ssf_recents, recents_data));
+
+    pack.serialize(_data);
+}
+
+bool startup_snapshot::unserialize(core::tools::binary_stream& _data)
+{
+    core::tools::tlvpack pack;
+    if (!pack.unserialize(_data))
+        return false;
+
+    auto tlv_contact_list = pack.get_item(startup_snapshot_fields::ssf_contact_list);
+    auto tlv_recents = pack.get_item(startup_snapshot_fields::ssf_recents);
+    if (!tlv_contact_list || !tlv_recents)
+        return false;
+
+    contact_list_ = tlv_contact_list->get_value<std::string>();
+
+    core::tools::tlvpack recents_pack;
+    if (!recents_pack.unserialize(tlv_recents->get_value<core::tools::binary_stream>()))
+        return false;
+
+    recents_.clear();
+    states_.clear();
+
+    for (auto record = recents_pack.get_first(); record; record = recents_pack.get_next())
+    {
+        core::tools::tlvpack record_pack;
+        if (!record_pack.unserialize(record->get_value<core::tools::binary_stream>()))
+            return false;
+
+        auto tlv_aimid = record_pack.get_item(startup_snapshot_fields::ssf_aimid);
+        auto tlv_state = record_pack.get_item(startup_snapshot_fields::ssf_state);
+        if (!tlv_aimid || !tlv_state)
+            return false;
+
+        auto state_data = tlv_state->get_value<core::tools::binary_stream>();
+
+        archive::dlg_state state;
+        if (!state.unserialize(state_data))
+            return false;
+
+        const auto aimid = tlv_aimid->get_value<std::string>();
+
+        recents_.push_back(aimid);
+        states_[aimid] = state;
+    }
+
+    changed_ = false;
+
+    return true;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "../../archive/dlg_state.h"
+
+namespace core
+{
+    namespace wim
+    {
+        // what the main window is painted from at startup, before the cached objects and the archive are loaded:
+        // the contact list and the dialog states of the recents, in one file
+        class startup_snapshot
+        {
+            // json of the contact list file
+            std::string contact_list_;
+
+            // aimids in the order of the recents
+            std::vector<std::string> recents_;
+
+            std::unordered_map<std::string, archive::dlg_state> states_;
+
+            bool changed_;
+
+        public:
+
+            startup_snapshot();
+
+            bool is_changed() const;
+            void set_changed(bool _changed);
+
+            void set_contact_list(const std::string& _json);
+            const std::string& get_contact_list() const;
+
+            void set_recents(std::vector<std::string> _recents);
+            const std::vector<std::string>& get_recents() const;
+
+            void update_state(const std::string& _aimid, const archive::dlg_state& _state);
+            const archive::dlg_state* get_state(const std::string& _aimid) const;
+
+            void serialize(core::tools::binary_stream& _data) const;
+            bool unserialize(core::tools::binary_stream& _data);
+        };
+    }
+}
@@ -72,8 +72,6 @@ void cl_presence::serialize(rapidjson::Value& _node, rapidjson_allocator& _a)
 
 void cl_presence::unserialize(const rapidjson::Value& _node)
 {
-    search_cache_.clear();
-
     auto iter_state = _node.FindMember("state");
     auto iter_user_type = _node.FindMember("userType");
     auto iter_capabilities = _node.FindMember("capabilities");
@@ -150,7 +148,9 @@ void contactlist::update_cl(const contactlist& _cl)
 {
     groups_ = _cl.groups_;
 
-    contacts_index_ = _cl.contacts_index_;
+    contacts_ = _cl.contacts_;
+
+    search_index_ = _cl.search_index_;
 
     set_changed(true);
     set_need_update_cache(true);
@@ -165,36 +165,24 @@ void contactlist::update_ignorelist(const ignorelist_cache& _ignorelist)
 }
 
 
-void contactlist::update_presence(const std::string& _aimid, std::shared_ptr<cl_presence> _presence)
+void contactlist::update_presence(const std::string& _aimid, const cl_presence& _presence)
 {
-    auto iter_contact = contacts_index_.find(_aimid);
-    if (iter_contact == contacts_index_.end())
+    const auto slot = contacts_.find(_aimid);
+    if (slot == contact_store::invalid_slot)
         return;
 
-    if (_presence->friendly_ != iter_contact->second->presence_->friendly_ ||
-        _presence->ab_contact_name_ != iter_contact->second->presence_->ab_contact_name_)
-    {
-        iter_contact->second->presence_->search_cache_.clear();
-    }
+    const bool names_changed = (_presence.friendly_ != contacts_.get_friendly(slot));
 
-    iter_contact->second->presence_->state_ = _presence->state_;
-    iter_contact->second->presence_->usertype_ = _presence->usertype_;
-    iter_contact->second->presence_->status_msg_ = _presence->status_msg_;
-    iter_contact->second->presence_->other_number_ = _presence->other_number_;
-    iter_contact->second->presence_->capabilities_ = _presence->capabilities_;
-    iter_contact->second->presence_->friendly_ = _presence->friendly_;
-    iter_contact->second->presence_->lastseen_ = _presence->lastseen_;
-    iter_contact->second->presence_->is_chat_ = _presence->is_chat_;
-    iter_contact->second->presence_->muted_ = _presence->muted_;
-    iter_contact->second->presence_->is_live_chat_ = _presence->is_live_chat_;
-    iter_contact->second->presence_->official_ = _presence->official_;
-    iter_contact->second->presence_->icon_id_ = _presence->icon_id_;
-    iter_contact->second->presence_->big_icon_id_ = _presence->big_icon_id_;
-    {
-        const auto large_icon_id = iter_contact->second->presence_->large_icon_id_;
-        iter_contact->second->presence_->large_icon_id_ = _presence->large_icon_id_;
-        need_update_avatar_ = (large_icon_id != iter_contact->second->presence_->large_icon_id_);
-    }
+    need_update_avatar_ = (_presence.large_icon_id_ != contacts_.get_large_icon_id(slot));
+
+    // the presence has no address book name, the known one stays
+    cl_presence presence = _presence;
+    presence.ab_contact_name_ = contacts_.get_ab_name(slot);
+
+    contacts_.set_presence(slot, presence);
+
+    if (names_changed)
+        search_index_.update(_aimid, contacts_.get_friendly(slot), contacts_.get_ab_name(slot));
 
     set_changed(true);
 }
@@ -203,26 +191,23 @@ void contactlist::serialize(rapidjson::Value& _node, rapidjson_allocator& _a)
 {
     rapidjson::Value node_groups(rapidjson::Type::kArrayType);
 
-    for (auto iter_group = groups_.begin(); iter_group != groups_.end(); iter_group++)
+    for (const auto& group : groups_)
     {
-        auto group = (*iter_group);
-
         rapidjson::Value node_group(rapidjson::Type::kObjectType);
 
-        node_group.AddMember("name",  group->name_, _a);
-        node_group.AddMember("id", group->id_, _a);
+        rapidjson::Value node_group_name;
+        node_group_name.SetString(group.name_.c_str(), (rapidjson::SizeType) group.name_.length(), _a);
+
+        node_group.AddMember("name", node_group_name, _a);
+        node_group.AddMember("id", group.id_, _a);
 
         rapidjson::Value node_buddies(rapidjson::Type::kArrayType);
 
-        for (auto iter_buddy = group->buddies_.begin(); iter_buddy != group->buddies_.end(); iter_buddy++)
+        for (const auto slot : group.buddies_)
         {
-            auto buddy = (*iter_buddy);
-
             rapidjson::Value node_buddy(rapidjson::Type::kObjectType);
 
-            node_buddy.AddMember("aimId",  buddy->aimid_, _a);
-
-            buddy->presence_->serialize(node_buddy, _a);
+            contacts_.serialize(slot, node_buddy, _a);
 
             node_buddies.PushBack(node_buddy, _a);
         }
@@ -254,30 +239,25 @@ void core::wim::contactlist::serialize(icollection* _coll, const std::string& ty
     ifptr<iarray> groups_array(_coll->create_array());
     groups_array->reserve((int32_t)groups_.size());
 
-    for (auto iter_group = groups_.begin(); iter_group != groups_.end(); iter_group++)
+    for (const auto& group : groups_)
     {
-        auto group = (*iter_group);
-
         coll_helper group_coll(_coll->create_collection(), true);
-        group_coll.set_value_as_string("group_name", group->name_);
-        group_coll.set_value_as_int("group_id", group->id_);
-        group_coll.set_value_as_bool("added", group->added_);
-        group_coll.set_value_as_bool("removed", group->removed_);
+        group_coll.set_value_as_string("group_name", group.name_);
+        group_coll.set_value_as_int("group_id", group.id_);
+        group_coll.set_value_as_bool("added", group.added_);
+        group_coll.set_value_as_bool("removed", group.removed_);
 
         ifptr<iarray> contacts_array(_coll->create_array());
-        contacts_array->reserve((int32_t)group->buddies_.size());
+        contacts_array->reserve((int32_t)group.buddies_.size());
 
-        for (auto iter_buddy = group->buddies_.begin(); iter_buddy != group->buddies_.end(); iter_buddy++)
+        for (const auto slot : group.buddies_)
         {
-            auto buddy = (*iter_buddy);
-
-            if (is_ignored(buddy->aimid_))
+            if (is_ignored(contacts_.get_aimid(slot)))
                 continue;
 
             coll_helper contact_coll(_coll->create_collection(), true);
-            contact_coll.set_value_as_string("aimId", buddy->aimid_);
 
-            buddy->presence_->serialize(contact_coll.get());
+            contacts_.serialize(slot, contact_coll.get());
 
             ifptr<ivalue> val_contact(_coll->create_value());
             val_contact->set_as_collection(contact_coll.get());
@@ -301,35 +281,25 @@ std::vector<std::string> core::wim::contactlist::search(const std::vector<std::v
 {
     std::vector<std::string> result;
 
-    std::string base_word;
-    for (auto symbol_iter = search_patterns.begin(); symbol_iter != search_patterns.end(); ++symbol_iter)
-    {
-        base_word.append((*symbol_iter)[0]);
-    }
+    std::set<std::string> result_cache;
 
-    std::map< std::string, std::shared_ptr<cl_buddy> > result_cache;
-    std::map< std::string, std::shared_ptr<cl_buddy> >::const_iterator iter = tmp_cache_.begin();
+    const auto candidates = search_index_.find_candidates(search_patterns, fixed_patterns_count);
 
-    while (g_core->is_valid_search() && iter != tmp_cache_.end())
+    for (auto iter_slot = candidates.begin(); g_core->is_valid_search() && iter_slot != candidates.end(); ++iter_slot)
     {
-        if (is_ignored(iter->first) || iter->second->presence_->usertype_ == "sms")
-        {
-            ++iter;
-            continue;
-        }
+        const auto& entry = search_index_.get_entry(*iter_slot);
 
-        if (iter->second->presence_->search_cache_.is_empty())
+        const auto slot = contacts_.find(entry.aimid_);
+        if (slot == contact_store::invalid_slot)
         {
-            iter->second->presence_->search_cache_.aimid_ = tools::system::to_upper(iter->second->aimid_);
-            iter->second->presence_->search_cache_.friendly_ = tools::system::to_upper(iter->second->presence_->friendly_);
-            iter->second->presence_->search_cache_.ab_ = tools::system::to_upper(iter->second->presence_->ab_contact_name_);
+            assert(false);
+            continue;
         }
 
-        const auto& aimId = iter->second->presence_->search_cache_.aimid_;
-        const auto& friendly = iter->second->presence_->search_cache_.friendly_;
-        const auto& ab = iter->second->presence_->search_cache_.ab_;
+        if (is_ignored(entry.aimid_) || contacts_.get_usertype(slot) == "sms")
+            continue;
 
-        auto check = [this, &result_cache, &result](std::map< std::string, std::shared_ptr<cl_buddy> >::const_iterator iter, 
+        auto check = [this, &result_cache, &result](const std::string& aimid, 
                                                        const std::vector<std::vector<std::string>>& search_patterns,
                                                        const std::string& word, 
                                                        int32_t fixed_patterns_count) 
@@ -340,41 +310,33 @@ std::vector<std::string> core::wim::contactlist::search(const std::vector<std::v
             int32_t priority = -1;
             if (tools::contains(search_patterns, word, fixed_patterns_count, priority))
             {
-                result_cache.insert(std::make_pair(iter->first, iter->second));
-                if (search_priority_.find(iter->first) != search_priority_.end())
+                result_cache.insert(aimid);
+                if (search_priority_.find(aimid) != search_priority_.end())
                 {
-                    search_priority_[iter->first] = std::min(search_priority_[iter->first], priority);
+                    search_priority_[aimid] = std::min(search_priority_[aimid], priority);
                 }
                 else
                 {
-                    search_priority_.insert(std::make_pair(iter->first, priority));
-                    result.push_back(iter->first);
+                    search_priority_.insert(std::make_pair(aimid, priority));
+                    result.push_back(aimid);
                 }
             }
         };
 
-        check(iter, search_patterns, friendly, fixed_patterns_count);
-        check(iter, search_patterns, ab, fixed_patterns_count);
-        check(iter, search_patterns, aimId, fixed_patterns_count);
-
-        ++iter;
+        for (const auto& word : entry.words_)
+            check(entry.aimid_, search_patterns, word, fixed_patterns_count);
     }
 
 
     if (g_core->is_valid_search())
     {
-        for (auto iter : result_cache)
-        {
-            search_cache_.insert(iter);
-        }
+        search_cache_.insert(result_cache.begin(), result_cache.end());
 
-        if (g_core->end_search() == 0)
-            last_search_patterns_ = base_word;
+        g_core->end_search();
 
         return result;
     }
 
-    last_search_patterns_.clear();
     g_core->end_search();
     return std::vector<std::string>();
 }
@@ -382,48 +344,35 @@ std::vector<std::string> core::wim::contactlist::search(const std::vector<std::v
 std::vector<std::string> core::wim::contactlist::search(const std::string& search_pattern, bool first, int32_t search_priority, int32_t fixed_patterns_count)
 {
     std::vector<std::string> result;
-    if (first)
-        search_priority_.clear();
-
-    std::string base_word = search_pattern;
-
     if (first)
     {
-        if (last_search_patterns_.empty() || base_word.find(last_search_patterns_.c_str()) == std::string::npos || need_update_search_cache_)
-        {
-            tmp_cache_ = contacts_index_;
-            set_need_update_cache(false);
-            search_cache_.clear();
-        }
-        else
-        {
-            tmp_cache_ = search_cache_;
-        }
+        search_priority_.clear();
+        set_need_update_cache(false);
     }
 
-    std::map< std::string, std::shared_ptr<cl_buddy> > result_cache;
-    std::map< std::string, std::shared_ptr<cl_buddy> >::const_iterator iter = tmp_cache_.begin();
+    std::set<std::string> result_cache;
+
+    // the index hands out only the contacts that have every bigram of the pattern,
+    // their words are checked below as before
+    contact_search_index::postings candidates;
+    if (!search_pattern.empty())
+        candidates = search_index_.find_candidates(search_pattern);
 
-    while (g_core->is_valid_search() && iter != tmp_cache_.end() && !search_pattern.empty())
+    for (auto iter_slot = candidates.begin(); g_core->is_valid_search() && iter_slot != candidates.end(); ++iter_slot)
     {
-        if (is_ignored(iter->first) || iter->second->presence_->usertype_ == "sms")
-        {
-            ++iter;
-            continue;
-        }
+        const auto& entry = search_index_.get_entry(*iter_slot);
 
-        if (iter->second->presence_->search_cache_.is_empty())
+        const auto slot = contacts_.find(entry.aimid_);
+        if (slot == contact_store::invalid_slot)
         {
-            iter->second->presence_->search_cache_.aimid_ = tools::system::to_upper(iter->second->aimid_);
-            iter->second->presence_->search_cache_.friendly_ = tools::system::to_upper(iter->second->presence_->friendly_);
-            iter->second->presence_->search_cache_.ab_ = tools::system::to_upper(iter->second->presence_->ab_contact_name_);
+            assert(false);
+            continue;
         }
 
-        const auto& aimId = iter->second->presence_->search_cache_.aimid_;
-        const auto& friendly = iter->second->presence_->search_cache_.friendly_;
-        const auto& ab = iter->second->presence_->search_cache_.ab_;
+        if (is_ignored(entry.aimid_) || contacts_.get_usertype(slot) == "sms")
+            continue;
 
-        auto check = [this, &result_cache, &result, search_priority](std::map< std::string, std::shared_ptr<cl_buddy> >::const_iterator iter, 
+        auto check = [this, &result_cache, &result, search_priority](const std::string& aimid, 
             const std::string& search_pattern,
             const std::string& word, 
             int32_t fixed_patterns_count) 
@@ -431,24 +380,21 @@ std::vector<std::string> core::wim::contactlist::search(const std::string& searc
             if (word.find(search_pattern) != std::string::npos)
             {
                 int32_t priority = word.length() == search_pattern.length() ? search_priority : search_priority + fixed_patterns_count + 1;
-                result_cache.insert(std::make_pair(iter->first, iter->second));
-                if (search_priority_.find(iter->first) != search_priority_.end())
+                result_cache.insert(aimid);
+                if (search_priority_.find(aimid) != search_priority_.end())
                 {
-                    search_priority_[iter->first] = std::min(search_priority_[iter->first], priority);
+                    search_priority_[aimid] = std::min(search_priority_[aimid], priority);
                 }
                 else
                 {
-                    search_priority_.insert(std::make_pair(iter->first, priority));
-                    result.push_back(iter->first);
+                    search_priority_.insert(std::make_pair(aimid, priority));
+                    result.push_back(aimid);
                 }
             }
         };
 
-        check(iter, search_pattern, friendly, fixed_patterns_count);
-        check(iter, search_pattern, ab, fixed_patterns_count);
-        check(iter, search_pattern, aimId, fixed_patterns_count);
-
-        ++iter;
+        for (const auto& word : entry.words_)
+            check(entry.aimid_, search_pattern, word, fixed_patterns_count);
     }
 
     if (g_core->is_valid_search())
@@ -456,15 +402,11 @@ std::vector<std::string> core::wim::contactlist::search(const std::string& searc
         if (first)
             search_cache_.clear();
 
-        for (auto iter : result_cache)
-        {
-            search_cache_.insert(iter);
-        }
+        search_cache_.insert(result_cache.begin(), result_cache.end());
 
         return result;
     }
     
-    last_search_patterns_.clear();
     return std::vector<std::string>();
 }
 
@@ -475,12 +417,10 @@ void core::wim::contactlist::serialize_search(icollection* _coll)
     ifptr<iarray> contacts_array(_coll->create_array());
     contacts_array->reserve((int32_t)search_cache_.size());
 
-    for (auto iter_buddy = search_cache_.begin(); iter_buddy != search_cache_.end(); iter_buddy++)
+    for (const auto& aimid : search_cache_)
     {
-        auto buddy = (*iter_buddy);
-
         coll_helper contact_coll(_coll->create_collection(), true);
-        contact_coll.set_value_as_string("aimId", iter_buddy->first);
+        contact_coll.set_value_as_string("aimId", aimid);
         ifptr<ivalue> val_contact(_coll->create_value());
         val_contact->set_as_collection(contact_coll.get());
         contacts_array->push_back(val_contact.get());
@@ -507,6 +447,10 @@ void contactlist::serialize_ignorelist(icollection* _coll)
 
 void contactlist::serialize_contact(const std::string& _aimid, icollection* _coll)
 {
+    const auto slot = contacts_.find(_aimid);
+    if (slot == contact_store::invalid_slot)
+        return;
+
     coll_helper coll(_coll, false);
         
     ifptr<iarray> groups_array(_coll->create_array());
@@ -514,67 +458,57 @@ void contactlist::serialize_contact(const std::string& _aimid, icollection* _col
     
     for (const auto& _group : groups_)
     {
-        for (const auto& _buddy : _group->buddies_)
-        {
-            if (_buddy->aimid_ == _aimid)
-            {
-                coll_helper coll_group(_coll->create_collection(), true);
-                coll_group.set_value_as_string("group_name", _group->name_);
-                coll_group.set_value_as_int("group_id", _group->id_);
-                coll_group.set_value_as_bool("added", _group->added_);
-                coll_group.set_value_as_bool("removed", _group->removed_);
+        if (std::find(_group.buddies_.begin(), _group.buddies_.end(), slot) == _group.buddies_.end())
+            continue;
 
-                ifptr<iarray> contacts_array(_coll->create_array());
+        coll_helper coll_group(_coll->create_collection(), true);
+        coll_group.set_value_as_string("group_name", _group.name_);
+        coll_group.set_value_as_int("group_id", _group.id_);
+        coll_group.set_value_as_bool("added", _group.added_);
+        coll_group.set_value_as_bool("removed", _group.removed_);
 
-                coll_helper coll_contact(coll->create_collection(), true);
-                coll_contact.set_value_as_string("aimId", _buddy->aimid_);
+        ifptr<iarray> contacts_array(_coll->create_array());
 
-                _buddy->presence_->serialize(coll_contact.get());
+        coll_helper coll_contact(coll->create_collection(), true);
 
-                ifptr<ivalue> val_contact(_coll->create_value());
-                val_contact->set_as_collection(coll_contact.get());
-                contacts_array->push_back(val_contact.get());
+        contacts_.serialize(slot, coll_contact.get());
 
-                ifptr<ivalue> val_group(_coll->create_value());
-                val_group->set_as_collection(coll_group.get());
-                groups_array->push_back(val_group.get());
+        ifptr<ivalue> val_contact(_coll->create_value());
+        val_contact->set_as_collection(coll_contact.get());
+        contacts_array->push_back(val_contact.get());
 
-                coll_group.set_value_as_array("contacts", contacts_array.get());
+        ifptr<ivalue> val_group(_coll->create_value());
+        val_group->set_as_collection(coll_group.get());
+        groups_array->push_back(val_group.get());
 
-                coll.set_value_as_array("groups", groups_array.get());
+        coll_group.set_value_as_array("contacts", contacts_array.get());
 
-                return;
-            }
-        }
+        coll.set_value_as_array("groups", groups_array.get());
+
+        return;
     }
 }
 
 std::string contactlist::get_contact_friendly_name(const std::string& contact_login) {
-    auto it = contacts_index_.find(contact_login);
-    if (contacts_index_.end() != it && !!it->second->presence_) {
-        return it->second->presence_->friendly_;
+    const auto slot = contacts_.find(contact_login);
+    if (slot != contact_store::invalid_slot) {
+        return contacts_.get_friendly(slot);
     }
     return "";
 }
 
-int32_t contactlist::unserialize(const rapidjson::Value& _node)
+int32_t contactlist::unserialize_groups(const rapidjson::Value& _node, const bool _is_diff)
 {
-    static long buddy_id = 0;
-
     const std::string chat_domain = "@chat.agent";
 
-    auto iter_groups = _node.FindMember("groups");
-    if (iter_groups == _node.MemberEnd() || !iter_groups->value.IsArray())
-        return 0;
-
-    for (auto iter_grp = iter_groups->value.Begin(); iter_grp != iter_groups->value.End(); ++iter_grp)
+    for (auto iter_grp = _node.Begin(); iter_grp != _node.End(); ++iter_grp)
     {
-        auto group = std::make_shared<core::wim::cl_group>();
+        cl_group group;
 
         auto iter_group_name = iter_grp->FindMember("name");
         if (iter_group_name != iter_grp->MemberEnd() && iter_group_name->value.IsString())
         {
-            group->name_ = iter_group_name->value.GetString();
+            group.name_ = iter_group_name->value.GetString();
         }
         else
         {
@@ -588,18 +522,21 @@ int32_t contactlist::unserialize(const rapidjson::Value& _node)
             continue;
         }
 
-        group->id_ = iter_group_id->value.GetUint();
-        groups_.push_back(group);
+        group.id_ = iter_group_id->value.GetUint();
+
+        if (_is_diff)
+        {
+            group.added_ = (iter_grp->FindMember("added") != iter_grp->MemberEnd());
+            group.removed_ = (iter_grp->FindMember("removed") != iter_grp->MemberEnd());
+        }
 
         auto iter_buddies = iter_grp->FindMember("buddies");
         if (iter_buddies != iter_grp->MemberEnd() && iter_buddies->value.IsArray())
         {
+            group.buddies_.reserve(iter_buddies->value.Size());
+
             for (auto iter_bd = iter_buddies->value.Begin(); iter_bd != iter_buddies->value.End(); ++iter_bd)
             {
-                auto buddy = std::make_shared<wim::cl_buddy>();
-
-                buddy->id_ = (uint32_t)++buddy_id;
-
                 auto iter_aimid = iter_bd->FindMember("aimId");
                 if (iter_aimid == iter_bd->MemberEnd() || !iter_aimid->value.IsString())
                 {
@@ -607,19 +544,38 @@ int32_t contactlist::unserialize(const rapidjson::Value& _node)
                     continue;
                 }
 
-                buddy->aimid_ = iter_aimid->value.GetString();
-                buddy->presence_->unserialize(*iter_bd);
-                
-                if (buddy->aimid_.length() > chat_domain.length() && buddy->aimid_.substr(buddy->aimid_.length() - chat_domain.length(), chat_domain.length()) == chat_domain)
-                    buddy->presence_->is_chat_ = true;
+                const std::string aimid = iter_aimid->value.GetString();
 
-                group->buddies_.push_back(buddy);
+                cl_presence presence;
+                presence.unserialize(*iter_bd);
 
-                contacts_index_[buddy->aimid_] = buddy;
+                if (aimid.length() > chat_domain.length() && aimid.compare(aimid.length() - chat_domain.length(), chat_domain.length(), chat_domain) == 0)
+                    presence.is_chat_ = true;
+
+                const auto slot = contacts_.insert(aimid);
+                contacts_.set_presence(slot, presence);
+
+                group.buddies_.push_back(slot);
+
+                if (!_is_diff)
+                    search_index_.update(aimid, presence.friendly_, presence.ab_contact_name_);
             }
         }
+
+        groups_.push_back(std::move(group));
     }
 
+    return 0;
+}
+
+int32_t contactlist::unserialize(const rapidjson::Value& _node)
+{
+    auto iter_groups = _node.FindMember("groups");
+    if (iter_groups == _node.MemberEnd() || !iter_groups->value.IsArray())
+        return 0;
+
+    unserialize_groups(iter_groups->value, false);
+
     auto iter_ignorelist = _node.FindMember("ignorelist");
     if (iter_ignorelist == _node.MemberEnd() || !iter_ignorelist->value.IsArray())
         return 0;
@@ -639,179 +595,115 @@ int32_t contactlist::unserialize(const rapidjson::Value& _node)
 
 int32_t contactlist::unserialize_from_diff(const rapidjson::Value& _node)
 {
-    static long buddy_id = 0;
-
-    const std::string chat_domain = "@chat.agent";
+    return unserialize_groups(_node, true);
+}
 
-    for (auto iter_grp = _node.Begin(); iter_grp != _node.End(); iter_grp++)
-    {
-        auto group = std::make_shared<core::wim::cl_group>();
+void contactlist::remove_unused_contacts(const std::set<std::string>& _aimids, std::list<std::string>& _removed)
+{
+    std::unordered_set<contact_store::slot> used_slots;
 
-        auto iter_group_name = iter_grp->FindMember("name");
-        if (iter_group_name != iter_grp->MemberEnd() && iter_group_name->value.IsString())
-        {
-            group->name_ = iter_group_name->value.GetString();
-        }
-        else
-        {
-            assert(false);
-        }
+    for (const auto& group : groups_)
+        used_slots.insert(group.buddies_.begin(), group.buddies_.end());
 
-        auto iter_group_id = iter_grp->FindMember("id");
-        if (iter_group_id == iter_grp->MemberEnd() || !iter_group_id->value.IsUint())
-        {
-            assert(false);
+    for (const auto& aimid : _aimids)
+    {
+        const auto slot = contacts_.find(aimid);
+        if (slot == contact_store::invalid_slot || used_slots.find(slot) != used_slots.end())
             continue;
-        }
-
-        group->id_ = iter_group_id->value.GetUint();
 
-        auto iter_group_added = iter_grp->FindMember("added");
-        if (iter_group_added != iter_grp->MemberEnd())
-        {
-            group->added_ = true;
-        }
-
-        auto iter_group_removed = iter_grp->FindMember("removed");
-        if (iter_group_removed != iter_grp->MemberEnd())
-        {
-            group->removed_ = true;
-        }
-
-        groups_.push_back(group);
-
-        auto iter_buddies = iter_grp->FindMember("buddies");
-        if (iter_buddies != iter_grp->MemberEnd() && iter_buddies->value.IsArray())
-        {
-            for (auto iter_bd = iter_buddies->value.Begin(); iter_bd != iter_buddies->value.End(); iter_bd++)
-            {
-                auto buddy = std::make_shared<wim::cl_buddy>();
-
-                buddy->id_ = (uint32_t)++buddy_id;
-
-                auto iter_aimid = iter_bd->FindMember("aimId");
-                if (iter_aimid == iter_bd->MemberEnd() || !iter_aimid->value.IsString())
-                {
-                    assert(false);
-                    continue;
-                }
-
-                buddy->aimid_ = iter_aimid->value.GetString();
-                buddy->presence_->unserialize(*iter_bd);
-
-                if (buddy->aimid_.length() > chat_domain.length() && buddy->aimid_.substr(buddy->aimid_.length() - chat_domain.length(), chat_domain.length()) == chat_domain)
-                    buddy->presence_->is_chat_ = true;
-
-                group->buddies_.push_back(buddy);
-
-                contacts_index_[buddy->aimid_] = buddy;
-            }
-        }
+        contacts_.remove(aimid);
+        search_index_.remove(aimid);
+        _removed.push_back(aimid);
     }
-
-    return 0;
 }
 
 void contactlist::merge_from_diff(const std::string& _type, std::shared_ptr<contactlist> _diff, std::shared_ptr<std::list<std::string>> removedContacts)
 {
+    const auto& diff_contacts = _diff->contacts_;
+
     if (_type == "created")
     {
-        for (auto diff_group_iter = _diff->groups_.begin(); diff_group_iter != _diff->groups_.end(); ++diff_group_iter)
+        for (const auto& diff_group : _diff->groups_)
         {
-            if ((*diff_group_iter)->added_)
+            if (diff_group.added_)
             {
-                auto group = std::make_shared<cl_group>();
-                group->id_ = (*diff_group_iter)->id_;
-                group->name_ = (*diff_group_iter)->name_;
+                cl_group group;
+                group.id_ = diff_group.id_;
+                group.name_ = diff_group.name_;
                 groups_.push_back(group);
             }
 
-
-            for (auto group_iter = groups_.begin(); group_iter != groups_.end(); ++group_iter)
+            for (auto& group : groups_)
             {
-                if ((*group_iter)->id_ != (*diff_group_iter)->id_)
+                if (group.id_ != diff_group.id_)
                     continue;
 
-                for (auto diff_buddy_iter = (*diff_group_iter)->buddies_.begin(); diff_buddy_iter != (*diff_group_iter)->buddies_.end(); ++diff_buddy_iter)
+                for (const auto diff_slot : diff_group.buddies_)
                 {
-                    (*group_iter)->buddies_.push_back((*diff_buddy_iter));
-                    contacts_index_[(*diff_buddy_iter)->aimid_] = (*diff_buddy_iter);
+                    const auto& aimid = diff_contacts.get_aimid(diff_slot);
+
+                    const auto slot = contacts_.insert(aimid);
+                    contacts_.set_presence(slot, diff_contacts.get_presence(diff_slot));
+
+                    group.buddies_.push_back(slot);
+                    search_index_.update(aimid, contacts_.get_friendly(slot), contacts_.get_ab_name(slot));
                 }
             }
         }
     }
     else if (_type == "updated")
     {
-        for (auto diff_group_iter = _diff->groups_.begin(); diff_group_iter != _diff->groups_.end(); ++diff_group_iter)
+        for (const auto& diff_group : _diff->groups_)
         {
-            for (auto diff_buddy_iter = (*diff_group_iter)->buddies_.begin(); diff_buddy_iter != (*diff_group_iter)->buddies_.end(); ++diff_buddy_iter)
+            for (const auto diff_slot : diff_group.buddies_)
             {
-                update_presence((*diff_buddy_iter)->aimid_, (*diff_buddy_iter)->presence_);
+                update_presence(diff_contacts.get_aimid(diff_slot), diff_contacts.get_presence(diff_slot));
             }
         }
     }
     else if (_type == "deleted")
     {
-        std::map<std::string, int> contacts;
+        std::set<std::string> contacts;
 
-        for (auto diff_group_iter = _diff->groups_.begin(); diff_group_iter != _diff->groups_.end(); ++diff_group_iter)
+        for (const auto& diff_group : _diff->groups_)
         {
+            std::unordered_set<contact_store::slot> deleted_slots;
+
+            for (const auto diff_slot : diff_group.buddies_)
+            {
+                const auto& aimid = diff_contacts.get_aimid(diff_slot);
+
+                const auto slot = contacts_.find(aimid);
+                if (slot == contact_store::invalid_slot)
+                    continue;
+
+                deleted_slots.insert(slot);
+                contacts.insert(aimid);
+            }
+
             for (auto group_iter = groups_.begin(); group_iter != groups_.end();)
             {
-                if ((*group_iter)->id_ != (*diff_group_iter)->id_)
+                if (group_iter->id_ != diff_group.id_)
                 {
-                    for (auto diff_buddy_iter = (*diff_group_iter)->buddies_.begin(); diff_buddy_iter != (*diff_group_iter)->buddies_.end(); ++diff_buddy_iter)
-                    {
-                        auto aimId = (*diff_buddy_iter)->aimid_;
-
-                        auto contact = std::find_if((*group_iter)->buddies_.begin(), (*group_iter)->buddies_.end(), [aimId](std::shared_ptr<cl_buddy> value) { return value->aimid_ == aimId; });
-                        if (contact != (*group_iter)->buddies_.end())
-                        {
-                            if (contacts.find(aimId) == contacts.end())
-                                contacts[aimId] = 1;
-                            else
-                                contacts[aimId]++;
-                        }
-                    }
-
                     ++group_iter;
                     continue;
                 }
 
-                for (auto diff_buddy_iter = (*diff_group_iter)->buddies_.begin(); diff_buddy_iter != (*diff_group_iter)->buddies_.end(); ++diff_buddy_iter)
+                auto& buddies = group_iter->buddies_;
+                buddies.erase(std::remove_if(buddies.begin(), buddies.end(), [&deleted_slots](const contact_store::slot _slot)
                 {
-                    auto aimId = (*diff_buddy_iter)->aimid_;
-                    (*group_iter)->buddies_.erase(std::remove_if((*group_iter)->buddies_.begin(), (*group_iter)->buddies_.end(), 
-                        [aimId, &contacts](std::shared_ptr<cl_buddy> value)
-                        {
-                            if (value->aimid_ == aimId)
-                            {
-                                if (contacts.find(aimId) == contacts.end())
-                                    contacts[aimId] = 1;
-                                else
-                                    contacts[aimId]++;
-                                return true;
-                            }
-                            return false;
-                        }
-                    ), (*group_iter)->buddies_.end());
-                }
+                    return (deleted_slots.find(_slot) != deleted_slots.end());
+                }), buddies.end());
 
-                if ((*diff_group_iter)->removed_)
+                if (diff_group.removed_)
                     group_iter = groups_.erase(group_iter);
                 else
                     ++group_iter;
             }
         }
 
-        for (auto c : contacts)
-        {
-            if (c.second == 1)
-            {
-                contacts_index_.erase(c.first);
-                removedContacts->push_back(c.first);
-            }
-        }
+        // a contact left in another group stays in the list
+        remove_unused_contacts(contacts, *removedContacts);
     }
     else
     {
@@ -823,19 +715,23 @@ void contactlist::merge_from_diff(const std::string& _type, std::shared_ptr<cont
 
 int32_t contactlist::get_contacts_count() const
 {
-    return contacts_index_.size();
+    return (int32_t) contacts_.size();
 }
 
 int32_t contactlist::get_phone_contacts_count() const
 {
-    return std::count_if (contacts_index_.begin(), contacts_index_.end(), [](std::pair<std::string, std::shared_ptr<cl_buddy>> contact)
-    {return contact.second.get()->aimid_.find("+") != contact.second.get()->aimid_.npos;});
+    const auto aimids = contacts_.get_aimids();
+
+    return (int32_t) std::count_if(aimids.begin(), aimids.end(), [](const std::string& _aimid)
+    {return _aimid.find("+") != _aimid.npos;});
 }
 
 int32_t contactlist::get_groupchat_contacts_count() const
 {
-    return std::count_if (contacts_index_.begin(), contacts_index_.end(), [](std::pair<std::string, std::shared_ptr<cl_buddy>> contact)
-    {return contact.second.get()->aimid_.find("@chat.agent") != contact.second.get()->aimid_.npos;});
+    const auto aimids = contacts_.get_aimids();
+
+    return (int32_t) std::count_if(aimids.begin(), aimids.end(), [](const std::string& _aimid)
+    {return _aimid.find("@chat.agent") != _aimid.npos;});
 }
 
 void contactlist::add_to_ignorelist(const std::string& _aimid)
@@ -854,14 +750,19 @@ void contactlist::remove_from_ignorelist(const std::string& _aimid)
     set_changed(true);
 }
 
-std::shared_ptr<cl_group> contactlist::get_first_group() const
+std::vector<std::string> contactlist::get_aimids() const
+{
+    return contacts_.get_aimids();
+}
+
+std::string contactlist::get_first_contact() const
 {
-    if (groups_.empty())
+    if (groups_.empty() || groups_.front().buddies_.empty())
     {
-        return nullptr;
+        return std::string();
     }
 
-    return (*groups_.begin());
+    return contacts_.get_aimid(groups_.front().buddies_.front());
 }
 
 bool contactlist::is_ignored(const std::string& _aimid)
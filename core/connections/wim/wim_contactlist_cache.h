@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include "contact_search_index.h"
+#include "contact_store.h"
+
 
 
 namespace core
@@ -34,17 +37,6 @@ namespace core
             std::string big_icon_id_;
             std::string large_icon_id_;
 
-            struct search_cache
-            {
-                std::string aimid_;
-                std::string friendly_;
-                std::string ab_;
-
-                bool is_empty() const { return aimid_.empty(); }
-                void clear() { aimid_.clear(); friendly_.clear(); ab_.clear(); }
-
-            } search_cache_;
-            
             cl_presence()
                 : is_chat_(false), muted_(false), lastseen_(-1), is_live_chat_(false), official_(false)
             {
@@ -55,22 +47,13 @@ namespace core
             void unserialize(const rapidjson::Value& _node);
         };
 
-        struct cl_buddy
-        {
-            uint32_t id_;
-            std::string aimid_;
-            std::shared_ptr<cl_presence> presence_;
-
-            cl_buddy() : id_(0), presence_(new cl_presence()) {}
-        };
-
-
         struct cl_group
         {
             uint32_t id_;
             std::string name_;
 
-            std::list<std::shared_ptr<cl_buddy>> buddies_;
+            // slots of the contacts in the store of the list
+            std::vector<contact_store::slot> buddies_;
 
             bool added_;
             bool removed_;
@@ -88,17 +71,22 @@ namespace core
             bool need_update_avatar_;
             void set_need_update_cache(bool _need_update_search_cache);
 
-            std::list<std::shared_ptr<cl_group>> groups_;
+            std::vector<cl_group> groups_;
+
+            contact_store contacts_;
 
             ignorelist_cache ignorelist_;
 
+            contact_search_index search_index_;
+
+            std::set<std::string> search_cache_;
+
+            int32_t unserialize_groups(const rapidjson::Value& _node, const bool _is_diff);
+            void remove_unused_contacts(const std::set<std::string>& _aimids, std::list<std::string>& _removed);
+
         public:
             // TODO : make it private
-            std::map<std::string, std::shared_ptr<cl_buddy>> search_cache_;
-            std::map<std::string, std::shared_ptr<cl_buddy>> tmp_cache_;
-            std::map< std::string, std::shared_ptr<cl_buddy> > contacts_index_;
             std::map<std::string, int32_t> search_priority_;
-            std::string last_search_patterns_;
             
             contactlist() : changed_(false), need_update_search_cache_(false), need_update_avatar_(false) {}
 
@@ -111,7 +99,7 @@ namespace core
             inline bool get_need_update_search_cache() const { return need_update_search_cache_; };
             inline bool get_need_update_avatar(bool reset) { auto need = need_update_avatar_; if (reset) need_update_avatar_ = false; return need; }
 
-            bool exist(const std::string& contact) { return contacts_index_.find(contact) != contacts_index_.end(); }
+            bool exist(const std::string& contact) const { return contacts_.find(contact) != contact_store::invalid_slot; }
 
             std::string get_contact_friendly_name(const std::string& contact_login);
 
@@ -126,7 +114,7 @@ namespace core
             std::vector<std::string> search(const std::vector<std::vector<std::string>>& search_patterns, int32_t fixed_patterns_count);
             std::vector<std::string> search(const std::string& search_pattern, bool first, int32_t searh_priority, int32_t fixed_patters_count);
 
-            void update_presence(const std::string& _aimid, std::shared_ptr<cl_presence> _presence);
+            void update_presence(const std::string& _aimid, const cl_presence& _presence);
             void merge_from_diff(const std::string& _type, std::shared_ptr<contactlist> _diff, std::shared_ptr<std::list<std::string>> removedContacts);
             
             int32_t get_contacts_count() const;
@@ -136,7 +124,10 @@ namespace core
             void add_to_ignorelist(const std::string& _aimid);
             void remove_from_ignorelist(const std::string& _aimid);
 
-            std::shared_ptr<cl_group> get_first_group() const;
+            std::vector<std::string> get_aimids() const;
+
+            // the first contact of the first group, a created chat comes in a diff of its own
+            std::string get_first_contact() const;
             bool is_ignored(const std::string& _aimid);
         };
     }
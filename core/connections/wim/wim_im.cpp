@@ -128,9 +128,11 @@
 #include "../../archive/messages_data.h"
 #include "stat/imstat.h"
 #include "dialog_holes.h"
+#include "startup_snapshot.h"
 #include "../../configuration/hosts_config.h"
 
 #include "../../log/log.h"
+#include "../../profiling/timeline.h"
 
 #include "../../configuration/app_config.h"
 #include "../../../common.shared/url_parser/url_parser.h"
@@ -166,15 +168,32 @@ namespace
 
     const auto rate_limit_timeout = std::chrono::milliseconds(30000); // 30
 
+    // the recognition requests do not depend on each other
+    const uint32_t speech_to_text_in_flight_count = 2;
+
+    const auto send_stats_log_period = std::chrono::minutes(10);
+
     const auto dlg_state_agregate_start_timeout = std::chrono::minutes(3);
     const auto dlg_state_agregate_period = std::chrono::seconds(60);
+
+    // the holes of so many dialogs are downloaded at once, and one more chain is kept for an opened dialog
+    const uint32_t holes_chains_count = 4;
+    const uint32_t holes_opened_chains_count = 1;
+
+    const auto holes_progress_period = std::chrono::seconds(1);
+
+    // recent dialogs below this position are filled in the order they were requested
+    const int32_t holes_top_dialogs_count = 20;
 }
 
 //////////////////////////////////////////////////////////////////////////
 // send_thread class
 //////////////////////////////////////////////////////////////////////////
 core::wim::wim_send_thread::wim_send_thread()
-    :   is_packet_execute_(false)
+    :   async_executer(WIM_SEND_THREAD_COUNT),
+        packets_in_flight_(0),
+        max_packets_in_flight_(WIM_SEND_THREAD_COUNT),
+        stats_log_time_(std::chrono::system_clock::now())
 {
 }
 
@@ -191,17 +210,20 @@ std::shared_ptr<async_task_handlers> core::wim::wim_send_thread::post_packet(
 
     std::shared_ptr<async_task_handlers> callback_handlers = _handlers ? _handlers : std::make_shared<async_task_handlers>();
 
-    const auto can_run_async = _packet->support_async_execution();
-
-    if (is_packet_execute_ && !can_run_async)
+    if (!_packet->support_async_execution())
     {
-        packets_queue_.push_back(task_and_params(_packet, _error_handler, callback_handlers));
+        auto& queue = queues_[_packet->get_send_queue()];
+
+        queue.packets_.push_back(task_and_params(_packet, _error_handler, callback_handlers));
+
+        auto& stats = stats_[_packet->get_name()];
+        stats.max_queue_depth_ = std::max(stats.max_queue_depth_, (uint32_t) queue.packets_.size());
+
+        execute_packets_from_queues();
+
         return callback_handlers;
     }
 
-    if (!can_run_async)
-        is_packet_execute_ = true;
-
     const auto current_time = std::chrono::system_clock::now();
 
     // need wait for timeout (ratelimts)
@@ -211,106 +233,173 @@ std::shared_ptr<async_task_handlers> core::wim::wim_send_thread::post_packet(
         {
             return 0;
 
-        })->on_result_ = [wr_this, callback_handlers](int32_t /*_error*/)
+        })->on_result_ = [callback_handlers](int32_t /*_error*/)
         {
-            auto ptr_this = wr_this.lock();
-            if (!ptr_this)
-                return;
-
             callback_handlers->on_result_(wpie_error_request_canceled_wait_timeout);
-
-            ptr_this->execute_packet_from_queue();
         };
 
         return callback_handlers;
     }
 
-    if (can_run_async)
+    _packet->execute_async([wr_this, _packet, _error_handler, callback_handlers](int32_t _error)
     {
-        _packet->execute_async([wr_this, _packet, _error_handler, callback_handlers](int32_t _error)
-        {
-            auto ptr_this = wr_this.lock();
-            if (!ptr_this)
-                return;
+        auto ptr_this = wr_this.lock();
+        if (!ptr_this)
+            return;
 
-            if (_error == wim_protocol_internal_error::wpie_network_error)
+        if (_error == wim_protocol_internal_error::wpie_network_error)
+        {
+            if ((_packet->get_repeat_count() < sent_repeat_count) && (!_packet->is_stopped()))
             {
-                if ((_packet->get_repeat_count() < sent_repeat_count) && (!_packet->is_stopped()))
-                {
-                    if (_packet->can_change_hosts_scheme())
-                        _packet->change_hosts_scheme();
+                if (_packet->can_change_hosts_scheme())
+                    _packet->change_hosts_scheme();
 
-                    ptr_this->run_async_function([]() { return 0; })->on_result_ = [wr_this, _packet, _error_handler, callback_handlers](int32_t /*_error*/)
-                    {
-                        auto ptr_this = wr_this.lock();
-                        if (ptr_this)
-                            ptr_this->post_packet(_packet, _error_handler, callback_handlers);
-                    };
+                ptr_this->run_async_function([]() { return 0; })->on_result_ = [wr_this, _packet, _error_handler, callback_handlers](int32_t /*_error*/)
+                {
+                    auto ptr_this = wr_this.lock();
+                    if (ptr_this)
+                        ptr_this->post_packet(_packet, _error_handler, callback_handlers);
+                };
 
-                    return;
-                }
-            }
-            else
-            {
-                if (_packet->is_hosts_scheme_changed())
-                    g_core->get_hosts_config().update_hosts(_packet->get_hosts_scheme());
+                return;
             }
+        }
+        else
+        {
+            if (_packet->is_hosts_scheme_changed())
+                g_core->get_hosts_config().update_hosts(_packet->get_hosts_scheme());
+        }
 
-            if (_error == wpie_error_too_fast_sending)
-            {
-                ptr_this->cancel_packets_time_ = std::chrono::system_clock::now() + rate_limit_timeout;
-            }
+        if (_error == wpie_error_too_fast_sending)
+        {
+            ptr_this->cancel_packets_time_ = std::chrono::system_clock::now() + rate_limit_timeout;
+        }
 
-            callback_handlers->on_result_(_error);
+        callback_handlers->on_result_(_error);
 
-            if (_error != 0)
+        if (_error != 0)
+        {
+            if (_error_handler)
             {
-                if (_error_handler)
-                {
-                    _error_handler(_error);
-                }
+                _error_handler(_error);
             }
+        }
+    });
 
-            ptr_this->run_async_function([]() { return 0; })->on_result_ = [wr_this](int32_t /*_error*/)
-            {
-                auto ptr_this = wr_this.lock();
-                if (ptr_this)
-                    ptr_this->execute_packet_from_queue();
-            };
-        });
+    return callback_handlers;
+}
 
-        return callback_handlers;
+
+std::shared_ptr<async_task_handlers> core::wim::wim_send_thread::post_packet(std::shared_ptr<wim_packet> _packet, const std::function<void(int32_t)> _error_handler)
+{
+    return post_packet(_packet, _error_handler, nullptr);
+}
+
+uint32_t core::wim::wim_send_thread::get_queue_limit(const std::string& _queue) const
+{
+    const auto iter = queue_limits_.find(_queue);
+    if (iter == queue_limits_.end())
+        return 1;
+
+    return iter->second;
+}
+
+void core::wim::wim_send_thread::execute_packets_from_queues()
+{
+    while (packets_in_flight_ < max_packets_in_flight_)
+    {
+        // the queue with the oldest packet goes first, if it has not reached its limit
+        auto next_queue = queues_.end();
+
+        for (auto iter = queues_.begin(); iter != queues_.end(); ++iter)
+        {
+            if (iter->second.packets_.empty() || iter->second.packets_in_flight_ >= get_queue_limit(iter->first))
+                continue;
+
+            if (next_queue == queues_.end() || iter->second.packets_.front().post_time_ < next_queue->second.packets_.front().post_time_)
+                next_queue = iter;
+        }
+
+        if (next_queue == queues_.end())
+            return;
+
+        auto next_packet = next_queue->second.packets_.front();
+        next_queue->second.packets_.pop_front();
+
+        execute_packet(next_queue->first, next_packet);
     }
+}
+
+void core::wim::wim_send_thread::execute_packet(const std::string& _queue, const task_and_params& _task)
+{
+    ++queues_[_queue].packets_in_flight_;
+    ++packets_in_flight_;
+
+    const auto start_time = std::chrono::system_clock::now();
+
+    stats_[_task.task_->get_name()].wait_time_ += std::chrono::duration_cast<std::chrono::milliseconds>(start_time - _task.post_time_);
 
-    auto internal_handlers = run_async_function([_packet]()->int32_t
+    run_packet(_queue, _task, start_time);
+}
+
+void core::wim::wim_send_thread::run_packet(const std::string& _queue, const task_and_params& _task, std::chrono::system_clock::time_point _start_time)
+{
+    std::weak_ptr<wim_send_thread> wr_this(shared_from_this());
+
+    const auto current_time = std::chrono::system_clock::now();
+
+    // need wait for timeout (ratelimts)
+    if (current_time < cancel_packets_time_)
     {
-        return _packet->execute();
-    });
+        run_async_function([]()->int32_t
+        {
+            return 0;
 
-    internal_handlers->on_result_ = [wr_this, _packet, _error_handler, callback_handlers](int32_t _error)
+        })->on_result_ = [wr_this, _queue, _task, _start_time](int32_t /*_error*/)
+        {
+            auto ptr_this = wr_this.lock();
+            if (!ptr_this)
+                return;
+
+            _task.callback_handlers_->on_result_(wpie_error_request_canceled_wait_timeout);
+
+            ptr_this->on_packet_finished(_queue, _task, _start_time);
+        };
+
+        return;
+    }
+
+    auto packet = _task.task_;
+
+    run_async_function([packet]()->int32_t
+    {
+        return packet->execute();
+
+    })->on_result_ = [wr_this, _queue, _task, _start_time](int32_t _error)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
             return;
 
+        const auto& packet = _task.task_;
+
         if (_error == wim_protocol_internal_error::wpie_network_error)
         {
-            if ((_packet->get_repeat_count() < sent_repeat_count) && (!_packet->is_stopped()))
+            if ((packet->get_repeat_count() < sent_repeat_count) && (!packet->is_stopped()))
             {
-                ptr_this->is_packet_execute_ = false;
+                if (packet->can_change_hosts_scheme())
+                    packet->change_hosts_scheme();
 
-                if (_packet->can_change_hosts_scheme())
-                    _packet->change_hosts_scheme();
-
-                ptr_this->post_packet(_packet, _error_handler, callback_handlers);
+                // the packet keeps its place in the queue
+                ptr_this->run_packet(_queue, _task, _start_time);
 
                 return;
             }
         }
         else
         {
-            if (_packet->is_hosts_scheme_changed())
-                g_core->get_hosts_config().update_hosts(_packet->get_hosts_scheme());
+            if (packet->is_hosts_scheme_changed())
+                g_core->get_hosts_config().update_hosts(packet->get_hosts_scheme());
         }
 
         if (_error == wpie_error_too_fast_sending)
@@ -318,49 +407,96 @@ std::shared_ptr<async_task_handlers> core::wim::wim_send_thread::post_packet(
             ptr_this->cancel_packets_time_ = std::chrono::system_clock::now() + rate_limit_timeout;
         }
 
-        callback_handlers->on_result_(_error);
-
-        ptr_this->is_packet_execute_ = false;
+        _task.callback_handlers_->on_result_(_error);
 
         if (_error != 0)
         {
-            if (_error_handler)
+            if (_task.error_handler_)
             {
-                _error_handler(_error);
+                _task.error_handler_(_error);
             }
         }
 
-        ptr_this->execute_packet_from_queue();
+        ptr_this->on_packet_finished(_queue, _task, _start_time);
     };
-
-    return callback_handlers;
 }
 
-
-std::shared_ptr<async_task_handlers> core::wim::wim_send_thread::post_packet(std::shared_ptr<wim_packet> _packet, const std::function<void(int32_t)> _error_handler)
+void core::wim::wim_send_thread::on_packet_finished(const std::string& _queue, const task_and_params& _task, std::chrono::system_clock::time_point _start_time)
 {
-    return post_packet(_packet, _error_handler, nullptr);
-}
+    assert(packets_in_flight_ > 0);
+    --packets_in_flight_;
 
+    const auto current_time = std::chrono::system_clock::now();
 
-void core::wim::wim_send_thread::execute_packet_from_queue()
-{
-    if (!packets_queue_.empty())
+    auto& stats = stats_[_task.task_->get_name()];
+    ++stats.sent_;
+    stats.execute_time_ += std::chrono::duration_cast<std::chrono::milliseconds>(current_time - _start_time);
+
+    auto iter_queue = queues_.find(_queue);
+    if (iter_queue != queues_.end())
     {
-        auto next_packet = packets_queue_.front();
-        packets_queue_.pop_front();
+        assert(iter_queue->second.packets_in_flight_ > 0);
+        --iter_queue->second.packets_in_flight_;
 
-        post_packet(next_packet.task_, next_packet.error_handler_, next_packet.callback_handlers_);
+        if (iter_queue->second.packets_.empty() && iter_queue->second.packets_in_flight_ == 0)
+            queues_.erase(iter_queue);
     }
+
+    if ((current_time - stats_log_time_) >= send_stats_log_period)
+    {
+        log_stats();
+
+        stats_log_time_ = current_time;
+    }
+
+    execute_packets_from_queues();
 }
 
 void core::wim::wim_send_thread::clear()
 {
-    for (auto iter = packets_queue_.begin(); iter != packets_queue_.end(); ++iter)
-        iter->callback_handlers_->on_result_(wpie_error_task_canceled);
+    for (auto iter_queue = queues_.begin(); iter_queue != queues_.end();)
+    {
+        for (auto iter = iter_queue->second.packets_.begin(); iter != iter_queue->second.packets_.end(); ++iter)
+            iter->callback_handlers_->on_result_(wpie_error_task_canceled);
+
+        iter_queue->second.packets_.clear();
+
+        // the queue of the packets in flight is released when they finish
+        if (iter_queue->second.packets_in_flight_ > 0)
+            ++iter_queue;
+        else
+            iter_queue = queues_.erase(iter_queue);
+    }
+
+    log_stats();
+}
+
+void core::wim::wim_send_thread::set_max_packets_in_flight(uint32_t _count)
+{
+    max_packets_in_flight_ = std::max(1u, std::min(_count, (uint32_t) WIM_SEND_THREAD_COUNT));
+
+    execute_packets_from_queues();
+}
+
+void core::wim::wim_send_thread::set_queue_limit(const std::string& _queue, uint32_t _count)
+{
+    queue_limits_[_queue] = std::max(1u, _count);
+
+    execute_packets_from_queues();
+}
 
-    packets_queue_.clear();
+void core::wim::wim_send_thread::log_stats() const
+{
+    for (const auto& stats : stats_)
+    {
+        if (stats.second.sent_ == 0)
+            continue;
 
+        __INFO("send_thread",
+            "packet=%1%, sent=%2%, max queue depth=%3%, avg wait=%4%ms, avg execute=%5%ms",
+            stats.first % stats.second.sent_ % stats.second.max_queue_depth_ %
+            (stats.second.wait_time_.count() / stats.second.sent_) % (stats.second.execute_time_.count() / stats.second.sent_));
+    }
 }
 //////////////////////////////////////////////////////////////////////////
 // end send_thread class
@@ -413,10 +549,12 @@ im::im(const im_login_id& _login, std::shared_ptr<voip_manager::VoipManager> _vo
     auth_params_(new auth_parameters()),
     attached_auth_params_(new auth_parameters()),
     fetch_params_(new fetch_parameters()),
+    fetch_pacer_(new fetch_pacer()),
     contact_list_(new contactlist()),
     active_dialogs_(new active_dialogs()),
     mailbox_storage_(new mailbox_storage()),
     snaps_storage_(new snaps_storage()),
+    startup_snapshot_(new startup_snapshot()),
     favorites_(new favorites()),
     store_timer_id_(0),
     stat_timer_id_(0),
@@ -428,6 +566,7 @@ im::im(const im_login_id& _login, std::shared_ptr<voip_manager::VoipManager> _vo
     my_info_cache_(new my_info_cache()),
     stop_objects_(new stop_objects()),
     failed_holes_requests_(new holes::failed_requests()),
+    holes_scheduler_(new holes::scheduler(holes_chains_count, holes_opened_chains_count)),
     im_created_(false),
     start_session_time_(std::chrono::system_clock::now() - std::chrono::milliseconds(start_session_timeout)),
     prefetch_uid_(INT64_MAX),
@@ -439,6 +578,8 @@ im::im(const im_login_id& _login, std::shared_ptr<voip_manager::VoipManager> _vo
     last_network_activity_time_(std::chrono::system_clock::now() - dlg_state_agregate_start_timeout)
 {
     stop_objects_weak_ = std::weak_ptr<stop_objects>(stop_objects_);
+
+    wim_send_thread_->set_queue_limit("speech_to_text", speech_to_text_in_flight_count);
 }
 
 
@@ -1141,8 +1282,9 @@ std::shared_ptr<async_task_handlers> im::load_contact_list()
 
     std::wstring contact_list_file = get_contactlist_file_name();
     auto contact_list = std::make_shared<contactlist>();
+    auto contact_list_json = std::make_shared<std::string>();
 
-    async_tasks_->run_async_function([contact_list_file, contact_list]
+    async_tasks_->run_async_function([contact_list_file, contact_list, contact_list_json]
     {
         core::tools::binary_stream bstream;
         if (!bstream.load_from_file(contact_list_file))
@@ -1150,13 +1292,63 @@ std::shared_ptr<async_task_handlers> im::load_contact_list()
 
         bstream.write<char>('\0');
 
+        const auto json = (const char*) bstream.read(bstream.available());
+
         rapidjson::Document doc;
-        if (doc.Parse((const char*) bstream.read(bstream.available())).HasParseError())
+        if (doc.Parse(json).HasParseError())
+            return -1;
+
+        *contact_list_json = json;
+
+        return contact_list->unserialize(doc);
+
+    })->on_result_ = [wr_this, contact_list, contact_list_json, handler](int32_t _error)
+    {
+        auto ptr_this = wr_this.lock();
+        if (!ptr_this)
+            return;
+
+        if (_error == 0)
+        {
+            timeline::mark("im.contact_list_loaded");
+
+            ptr_this->contact_list_ = contact_list;
+            ptr_this->startup_snapshot_->set_contact_list(*contact_list_json);
+            ptr_this->post_contact_list_to_gui();
+        }
+
+        if (handler->on_result_)
+            handler->on_result_(_error);
+    };
+
+    return handler;
+}
+
+std::shared_ptr<async_task_handlers> im::load_startup_snapshot()
+{
+    auto handler = std::make_shared<async_task_handlers>();
+    std::weak_ptr<core::wim::im> wr_this = shared_from_this();
+
+    std::wstring snapshot_file = get_startup_snapshot_file_name();
+    auto snapshot = std::make_shared<startup_snapshot>();
+    auto contact_list = std::make_shared<contactlist>();
+
+    async_tasks_->run_async_function([snapshot_file, snapshot, contact_list]
+    {
+        core::tools::binary_stream bstream;
+        if (!bstream.load_from_file(snapshot_file))
+            return -1;
+
+        if (!snapshot->unserialize(bstream))
+            return -1;
+
+        rapidjson::Document doc;
+        if (doc.Parse(snapshot->get_contact_list().c_str()).HasParseError())
             return -1;
 
         return contact_list->unserialize(doc);
 
-    })->on_result_ = [wr_this, contact_list, handler](int32_t _error)
+    })->on_result_ = [wr_this, snapshot, contact_list, handler](int32_t _error)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -1164,8 +1356,13 @@ std::shared_ptr<async_task_handlers> im::load_contact_list()
 
         if (_error == 0)
         {
+            timeline::mark("im.startup_snapshot_loaded");
+
             ptr_this->contact_list_ = contact_list;
+            ptr_this->startup_snapshot_ = snapshot;
+
             ptr_this->post_contact_list_to_gui();
+            ptr_this->post_startup_snapshot_to_gui();
         }
 
         if (handler->on_result_)
@@ -1406,8 +1603,30 @@ void im::post_stickers_meta_to_gui(int64_t _seq, const std::string& _size)
     };
 }
 
+void im::post_stickers_download_progress_to_gui(int32_t _loaded, int32_t _total)
+{
+    coll_helper coll(g_core->create_collection(), true);
+
+    coll.set_value_as_int("loaded", _loaded);
+    coll.set_value_as_int("total", _total);
+
+    g_core->post_message_to_gui("stickers/download/progress", 0, coll.get());
+}
+
 void im::download_stickers_metadata(int64_t _seq, const std::string _size)
 {
+    while (get_stickers()->add_meta_worker())
+        download_next_stickers_metadata(_seq, _size);
+}
+
+void im::download_next_stickers_metadata(int64_t _seq, const std::string& _size)
+{
+    if (get_stickers()->get_last_error() == loader_errors::network_error)
+    {
+        get_stickers()->remove_meta_worker();
+        return;
+    }
+
     std::weak_ptr<im> wr_this = shared_from_this();
 
     get_stickers()->get_next_meta_task()->on_result_ = [wr_this, _size, _seq](bool _res, const stickers::download_task& _task)
@@ -1418,6 +1637,10 @@ void im::download_stickers_metadata(int64_t _seq, const std::string _size)
 
         if (!_res)
         {
+            // the last worker moves on to the stickers when all the icons are loaded
+            if (!ptr_this->get_stickers()->remove_meta_worker() || ptr_this->get_stickers()->get_last_error() == loader_errors::network_error)
+                return;
+
             if (!ptr_this->get_stickers()->is_up_to_date() || g_core->locale_was_changed())
                 ptr_this->post_stickers_meta_to_gui(_seq, _size);
 
@@ -1437,6 +1660,16 @@ void im::download_stickers_metadata(int64_t _seq, const std::string _size)
                 {
                     ptr_this->get_stickers()->set_last_error(loader_errors::network_error);
                     ptr_this->get_stickers()->set_failed_step(stickers::failed_step::download_metadata);
+
+                    ptr_this->get_stickers()->on_task_failed(_task)->on_result_ = [wr_this](bool)
+                    {
+                        auto ptr_this = wr_this.lock();
+                        if (!ptr_this)
+                            return;
+
+                        ptr_this->get_stickers()->remove_meta_worker();
+                    };
+
                     return;
                 }
 
@@ -1446,7 +1679,7 @@ void im::download_stickers_metadata(int64_t _seq, const std::string _size)
                     if (!ptr_this)
                         return;
 
-                    ptr_this->download_stickers_metadata(_seq, _size);
+                    ptr_this->download_next_stickers_metadata(_seq, _size);
                 };
             }));
     };
@@ -1496,6 +1729,18 @@ void post_sticker_2_gui(int64_t _seq, int32_t _set_id, int32_t _sticker_id, core
 
 void im::download_stickers(int64_t _seq, const std::string _size)
 {
+    while (get_stickers()->add_sticker_worker())
+        download_next_sticker(_seq, _size);
+}
+
+void im::download_next_sticker(int64_t _seq, const std::string& _size)
+{
+    if (get_stickers()->get_last_error() == loader_errors::network_error)
+    {
+        get_stickers()->remove_sticker_worker();
+        return;
+    }
+
     std::weak_ptr<im> wr_this = shared_from_this();
 
     get_stickers()->get_next_sticker_task()->on_result_ = [wr_this, _size, _seq](bool _res, const stickers::download_task& _task)
@@ -1506,7 +1751,9 @@ void im::download_stickers(int64_t _seq, const std::string _size)
 
         if (!_res)
         {
-            ptr_this->get_stickers()->set_download_in_progress(false);
+            if (ptr_this->get_stickers()->remove_sticker_worker() && ptr_this->get_stickers()->get_last_error() != loader_errors::network_error)
+                ptr_this->get_stickers()->set_download_in_progress(false);
+
             return;
         }
 
@@ -1521,13 +1768,23 @@ void im::download_stickers(int64_t _seq, const std::string _size)
                 {
                     ptr_this->get_stickers()->set_last_error(loader_errors::network_error);
                     ptr_this->get_stickers()->set_failed_step(stickers::failed_step::download_stickers);
+
+                    ptr_this->get_stickers()->on_task_failed(_task)->on_result_ = [wr_this](bool)
+                    {
+                        auto ptr_this = wr_this.lock();
+                        if (!ptr_this)
+                            return;
+
+                        ptr_this->get_stickers()->remove_sticker_worker();
+                    };
+
                     return;
                 }
 
                 int32_t set_id = _task.get_set_id(), sticker_id = _task.get_sticker_id(); sticker_size sz = _task.get_size();
 
                 ptr_this->get_stickers()->on_sticker_loaded(_task)->on_result_ = [wr_this, _seq, _size, set_id, sticker_id, sz, _error]
-                (bool _res, const std::list<int64_t>& _requests)
+                (bool _res, const std::list<int64_t>& _requests, const stickers::download_progress& _progress)
                 {
                     auto ptr_this = wr_this.lock();
                     if (!ptr_this)
@@ -1546,7 +1803,10 @@ void im::download_stickers(int64_t _seq, const std::string _size)
                         };
                     }
 
-                    ptr_this->download_stickers(_seq, _size);
+                    if (_res)
+                        ptr_this->post_stickers_download_progress_to_gui(_progress.loaded_, _progress.total_);
+
+                    ptr_this->download_next_sticker(_seq, _size);
                 };
             }));
     };
@@ -1637,74 +1897,95 @@ void im::load_cached_objects()
         return;
     }
 
-    load_contact_list()->on_result_ = [wr_this, call_on_exit](int32_t _error)
+    load_startup_snapshot()->on_result_ = [wr_this, call_on_exit](int32_t _error)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
             return;
 
-        if (_error != 0)
+        // the snapshot has the contact list
+        if (_error == 0)
+        {
+            ptr_this->load_cached_objects_after_contact_list(call_on_exit);
             return;
+        }
 
-        ptr_this->load_snaps_storage()->on_result_ = [wr_this, call_on_exit](int32_t _error)
+        ptr_this->load_contact_list()->on_result_ = [wr_this, call_on_exit](int32_t _error)
         {
             auto ptr_this = wr_this.lock();
             if (!ptr_this)
                 return;
 
-            ptr_this->load_mailboxes()->on_result_ = [wr_this, call_on_exit](int32_t _error)
+            if (_error != 0)
+                return;
+
+            ptr_this->load_cached_objects_after_contact_list(call_on_exit);
+        };
+    };
+}
+
+void im::load_cached_objects_after_contact_list(std::shared_ptr<tools::auto_scope_bool> _call_on_exit)
+{
+    std::weak_ptr<core::wim::im> wr_this = shared_from_this();
+
+    load_snaps_storage()->on_result_ = [wr_this, _call_on_exit](int32_t _error)
+    {
+        auto ptr_this = wr_this.lock();
+        if (!ptr_this)
+            return;
+
+        ptr_this->load_mailboxes()->on_result_ = [wr_this, _call_on_exit](int32_t _error)
+        {
+            auto ptr_this = wr_this.lock();
+            if (!ptr_this)
+                return;
+
+            ptr_this->load_my_info()->on_result_ = [wr_this, _call_on_exit](int32_t _error)
             {
                 auto ptr_this = wr_this.lock();
                 if (!ptr_this)
                     return;
 
-                ptr_this->load_my_info()->on_result_ = [wr_this, call_on_exit](int32_t _error)
+                if (_error != 0)
+                    return;
+
+                ptr_this->load_favorites()->on_result_ = [wr_this, _call_on_exit](int32_t _error)
                 {
                     auto ptr_this = wr_this.lock();
                     if (!ptr_this)
                         return;
 
-                    if (_error != 0)
-                        return;
-
-                    ptr_this->load_favorites()->on_result_ = [wr_this, call_on_exit](int32_t _error)
+                    ptr_this->load_active_dialogs()->on_result_ = [wr_this, _call_on_exit](int32_t _error)
                     {
                         auto ptr_this = wr_this.lock();
                         if (!ptr_this)
                             return;
 
-                        ptr_this->load_active_dialogs()->on_result_ = [wr_this, call_on_exit](int32_t _error)
+                        if (_error == 0)
                         {
-                            auto ptr_this = wr_this.lock();
-                            if (!ptr_this)
-                                return;
+                            _call_on_exit->set_success();
 
-                            if (_error == 0)
+                            auto avatar_size = g_core->get_core_gui_settings().recents_avatars_size_;
+
+                            ptr_this->active_dialogs_->enumerate([wr_this, avatar_size](const active_dialog& _dlg)
                             {
-                                call_on_exit->set_success();
+                                auto ptr_this = wr_this.lock();
+                                if (!ptr_this)
+                                    return;
 
-                                auto avatar_size = g_core->get_core_gui_settings().recents_avatars_size_;
+                                const auto &dlg_aimid = _dlg.get_aimid();
 
-                                ptr_this->active_dialogs_->enumerate([wr_this, avatar_size](const active_dialog& _dlg)
+                                if (!ptr_this->contact_list_->is_ignored(dlg_aimid))
                                 {
-                                    auto ptr_this = wr_this.lock();
-                                    if (!ptr_this)
-                                        return;
-
-                                    const auto &dlg_aimid = _dlg.get_aimid();
-
-                                    if (!ptr_this->contact_list_->is_ignored(dlg_aimid))
-                                    {
-                                        if (avatar_size > 0)
-                                            ptr_this->get_contact_avatar(-1, _dlg.get_aimid(), avatar_size, false);
+                                    if (avatar_size > 0)
+                                        ptr_this->get_contact_avatar(-1, _dlg.get_aimid(), avatar_size, false);
 
-                                        ptr_this->post_dlg_state_to_gui(dlg_aimid);
-                                    }
-                                });
+                                    ptr_this->post_dlg_state_to_gui(dlg_aimid);
+                                }
+                            });
 
-                                ptr_this->post_ignorelist_to_gui(0);
-                            }
-                        };
+                            ptr_this->post_ignorelist_to_gui(0);
+                        }
                     };
                 };
             };
@@ -2213,6 +2494,8 @@ void im::save_contact_list()
 
     contact_list_->set_changed(false);
 
+    startup_snapshot_->set_contact_list(json_string);
+
     auto handler = async_tasks_->run_async_function([contact_list_file, json_string]
     {
         core::tools::binary_stream bstream;
@@ -2337,6 +2620,13 @@ void im::save_snaps_storage()
     });
 }
 
+void im::save_dlg_states()
+{
+    // the dialog states changed since the last call are written in one append
+    if (archive_)
+        archive_->flush_dlg_states();
+}
+
 void im::save_cached_objects()
 {
     save_my_info();
@@ -2345,6 +2635,59 @@ void im::save_cached_objects()
     save_favorites();
     save_mailboxes();
     save_snaps_storage();
+    save_dlg_states();
+    save_startup_snapshot();
+}
+
+void im::save_startup_snapshot()
+{
+    std::vector<std::string> recents;
+    recents.reserve(active_dialogs_->size());
+
+    active_dialogs_->enumerate([&recents](const active_dialog& _dlg)
+    {
+        recents.push_back(_dlg.get_aimid());
+    });
+
+    // enumerate gives the oldest dialog first
+    std::reverse(recents.begin(), recents.end());
+
+    startup_snapshot_->set_recents(std::move(recents));
+
+    if (!startup_snapshot_->is_changed() || startup_snapshot_->get_contact_list().empty())
+        return;
+
+    startup_snapshot_->set_changed(false);
+
+    auto bs_data = std::make_shared<core::tools::binary_stream>();
+    startup_snapshot_->serialize(*bs_data);
+
+    std::wstring file_name = get_startup_snapshot_file_name();
+
+    std::weak_ptr<im> wr_this = shared_from_this();
+
+    async_tasks_->run_async_function([bs_data, file_name]
+    {
+        if (!bs_data->save_2_file(file_name))
+        {
+            // the old snapshot would replace the newer contact list on the next start
+            tools::system::delete_file(file_name);
+            return -1;
+        }
+
+        return 0;
+    })->on_result_ = [wr_this](int32_t _error)
+    {
+        if (_error == 0)
+            return;
+
+        auto ptr_this = wr_this.lock();
+        if (!ptr_this)
+            return;
+
+        // written again by the next save
+        ptr_this->startup_snapshot_->set_changed(true);
+    };
 }
 
 void im::start_session(bool _is_ping)
@@ -2371,6 +2714,8 @@ void im::start_session(bool _is_ping)
 
         if (_error == 0)
         {
+            timeline::mark("im.session_started");
+
             time_t time_offset = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now()) - packet->get_ts();
 
             ptr_this->auth_params_->aimsid_ = packet->get_aimsid();
@@ -2584,16 +2929,18 @@ void im::poll(bool _is_first, bool _after_network_error, int32_t _failed_network
     if (!fetch_params_->is_valid())
         return start_session();
 
-    const int32_t timeout = 60*1000;
+    const bool is_long_poll = (!_is_first && !_after_network_error);
+
+    const int32_t timeout = (int32_t) fetch_pacer_->get_timeout().count();
 
     auto active_session_id = stop_objects_->active_session_id_;
 
     auto packet = std::make_shared<fetch>(make_wim_params(), fetch_params_->fetch_url_, 
-        ((_is_first || _after_network_error) ? 1 : timeout), fetch_params_->next_fetch_time_, std::bind(&im::wait_function, this, std::placeholders::_1));
+        (is_long_poll ? timeout : 1), fetch_params_->next_fetch_time_, std::bind(&im::wait_function, this, std::placeholders::_1));
 
     std::weak_ptr<im> wr_this = shared_from_this();
 
-    fetch_thread_->run_async_task(packet)->on_result_ = [_is_first, _after_network_error, active_session_id, packet, wr_this, _failed_network_error_count](int32_t _error)
+    fetch_thread_->run_async_task(packet)->on_result_ = [_is_first, _after_network_error, is_long_poll, active_session_id, packet, wr_this, _failed_network_error_count](int32_t _error)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -2605,6 +2952,13 @@ void im::poll(bool _is_first, bool _after_network_error, int32_t _failed_network
 
         if (_error == 0)
         {
+            ptr_this->fetch_pacer_->on_fetched(packet->get_events_count(), is_long_poll);
+
+            // the server's timeToNextFetch stays the lower bound
+            ptr_this->fetch_params_->next_fetch_time_ = std::max(
+                ptr_this->fetch_params_->next_fetch_time_,
+                std::chrono::system_clock::now() + ptr_this->fetch_pacer_->get_delay());
+
             ptr_this->dispatch_events(packet,[packet, wr_this, active_session_id, _is_first](int32_t _error)
             {
                 auto ptr_this = wr_this.lock();
@@ -2641,6 +2995,8 @@ void im::poll(bool _is_first, bool _after_network_error, int32_t _failed_network
 
                 if (_is_first)
                 {
+                    timeline::mark("im.first_fetch");
+
                     g_core->post_message_to_gui("login/complete", 0, 0);
 
                     ptr_this->send_timezone();
@@ -2654,6 +3010,8 @@ void im::poll(bool _is_first, bool _after_network_error, int32_t _failed_network
 
             if (_error == wpie_network_error)
             {
+                ptr_this->fetch_pacer_->on_network_error();
+
                 if (_failed_network_error_count > 2)
                 {
                     if (_is_first && g_core->try_to_apply_alternative_settings())
@@ -3094,6 +3452,8 @@ void im::on_event_buddies_list(fetch_event_buddy_list* _event, std::shared_ptr<a
             if (!ptr_this)
                 return;
 
+            timeline::mark("im.contact_list_received");
+
             ptr_this->contact_list_->update_cl(*contact_list);
             ptr_this->need_update_search_cache();
 
@@ -3157,28 +3517,16 @@ void im::on_created_groupchat(std::shared_ptr<diffs_map> _diff)
     {
         if (iter->first == "created")
         {
-            auto group = iter->second->get_first_group();
+            const auto aimid = iter->second->get_first_contact();
 
-            if (!group)
+            if (!aimid.empty())
             {
-                assert(false);
-                continue;
-            }
+                coll_helper created_chat_coll(g_core->create_collection(), true);
 
-            if (!group->buddies_.empty())
-            {
-                auto buddy = *(group->buddies_.begin());
+                created_chat_coll.set_value_as_string("aimId", aimid);
+                g_core->post_message_to_gui("open_created_chat", 0, created_chat_coll.get());
 
-                if (!!buddy)
-                {
-                    coll_helper created_chat_coll(g_core->create_collection(), true);
-
-                    std::string aimid = buddy.get()->aimid_;
-                    created_chat_coll.set_value_as_string("aimId", aimid);
-                    g_core->post_message_to_gui("open_created_chat", 0, created_chat_coll.get());
-
-                    return;
-                }
+                return;
             }
         }
     }
@@ -3227,7 +3575,7 @@ void im::on_event_presence(fetch_event_presence* _event, std::shared_ptr<auto_ca
     presence->serialize(cl_coll.get());
     g_core->post_message_to_gui("contact_presence", 0, cl_coll.get());
 
-    contact_list_->update_presence(aimid, presence);
+    contact_list_->update_presence(aimid, *presence);
     if (contact_list_->get_need_update_avatar(true))
     {
         coll_helper coll(g_core->create_collection(), true);
@@ -3961,6 +4309,109 @@ void im::download_holes(const std::string& _contact, int64_t _depth, std::functi
 
 
 void im::download_holes(const std::string& _contact, int64_t _from, int64_t _depth, int32_t _recursion, std::function<void(int64_t)> last_message_catcher)
+{
+    holes_scheduler_->add(holes::request(_contact, _from, _depth, _recursion), last_message_catcher);
+
+    run_holes_scheduler();
+
+    post_holes_progress_to_gui();
+}
+
+void im::run_holes_scheduler()
+{
+    if (!holes_scheduler_->can_start())
+        return;
+
+    // the opened dialogs go first, then the top of the recents
+    std::vector<std::string> recents;
+
+    active_dialogs_->enumerate([&recents](const active_dialog& _dialog)
+    {
+        recents.push_back(_dialog.get_aimid());
+    });
+
+    // enumerate gives the oldest dialog first, so the top of the recents is at the end
+    std::unordered_map<std::string, int32_t> recents_ranks;
+
+    for (auto iter = recents.rbegin(); iter != recents.rend() && recents_ranks.size() < (size_t) holes_top_dialogs_count; ++iter)
+        recents_ranks.emplace(*iter, (int32_t) recents_ranks.size() + 1);
+
+    auto rank = [this, &recents_ranks](const std::string& _contact)
+    {
+        if (has_opened_dialogs(_contact))
+            return 0;
+
+        const auto iter = recents_ranks.find(_contact);
+        if (iter != recents_ranks.end())
+            return iter->second;
+
+        return holes_top_dialogs_count + 1;
+    };
+
+    std::weak_ptr<im> wr_this = shared_from_this();
+
+    while (auto next = holes_scheduler_->get_next(rank))
+    {
+        const auto contact = next->request_.get_contact();
+
+        // the chain is finished when the last of its callbacks is released
+        auto chain = std::make_shared<tools::auto_scope>([wr_this, contact]
+        {
+            if (!g_core)
+                return;
+
+            g_core->execute_core_context([wr_this, contact]
+            {
+                auto ptr_this = wr_this.lock();
+                if (!ptr_this)
+                    return;
+
+                ptr_this->holes_scheduler_->on_finished(contact);
+
+                if (ptr_this->holes_scheduler_->is_idle())
+                {
+                    const auto& progress = ptr_this->holes_scheduler_->get_progress();
+                    __INFO("archive", "holes scheduler is idle, requests=%1%, chains=%2%", progress.added_ % progress.finished_);
+                }
+
+                ptr_this->run_holes_scheduler();
+
+                ptr_this->post_holes_progress_to_gui();
+            });
+        });
+
+        download_holes_chain(
+            contact,
+            next->request_.get_from(),
+            next->request_.get_depth(),
+            next->request_.get_recursion(),
+            next->last_message_catcher_,
+            chain);
+    }
+}
+
+void im::post_holes_progress_to_gui()
+{
+    const auto now = std::chrono::steady_clock::now();
+    const auto is_idle = holes_scheduler_->is_idle();
+
+    // the progress is posted at most once a second, the end of the work always
+    if (!is_idle && (now - holes_progress_post_time_) < holes_progress_period)
+        return;
+
+    holes_progress_post_time_ = now;
+
+    const auto& progress = holes_scheduler_->get_progress();
+
+    coll_helper coll(g_core->create_collection(), true);
+    coll.set_value_as_uint("pending", holes_scheduler_->get_pending_count());
+    coll.set_value_as_uint("running", holes_scheduler_->get_running_count());
+    coll.set_value_as_uint("finished", progress.finished_);
+
+    g_core->post_message_to_gui("archive/holes/progress", 0, coll.get());
+}
+
+void im::download_holes_chain(const std::string& _contact, int64_t _from, int64_t _depth, int32_t _recursion, std::function<void(int64_t)> last_message_catcher, std::shared_ptr<tools::auto_scope> _chain)
 {
     __INFO("archive", "im::download_holes, contact=%1%", _contact);
 
@@ -3969,7 +4420,7 @@ void im::download_holes(const std::string& _contact, int64_t _from, int64_t _dep
     holes::request hole_request(_contact, _from, _depth, _recursion);
 
     get_archive()->get_next_hole(_contact, _from, _depth)->on_result =
-    	[wr_this, _contact, _depth, _recursion, hole_request, last_message_catcher](std::shared_ptr<archive::archive_hole> _hole)
+    	[wr_this, _contact, _depth, _recursion, hole_request, last_message_catcher, _chain](std::shared_ptr<archive::archive_hole> _hole)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -3990,7 +4441,7 @@ void im::download_holes(const std::string& _contact, int64_t _from, int64_t _dep
             return;
         }
 
-        ptr_this->get_archive()->get_dlg_state(_contact)->on_result = [wr_this, _hole, _contact, _depth, _recursion, hole_request, last_message_catcher](const archive::dlg_state& _state)
+        ptr_this->get_archive()->get_dlg_state(_contact)->on_result = [wr_this, _hole, _contact, _depth, _recursion, hole_request, last_message_catcher, _chain](const archive::dlg_state& _state)
         {
             auto ptr_this = wr_this.lock();
             if (!ptr_this)
@@ -4039,7 +4490,7 @@ void im::download_holes(const std::string& _contact, int64_t _from, int64_t _dep
                     return;
             }
 
-            ptr_this->get_history_from_server(hist_params, last_message_catcher)->on_result_ = [wr_this, _contact, _hole, depth_tail, _recursion, hole_request, count, last_message_catcher](int32_t _error)
+            ptr_this->get_history_from_server(hist_params, last_message_catcher)->on_result_ = [wr_this, _contact, _hole, depth_tail, _recursion, hole_request, count, last_message_catcher, _chain](int32_t _error)
             {
                 auto ptr_this = wr_this.lock();
                 if (!ptr_this)
@@ -4047,13 +4498,13 @@ void im::download_holes(const std::string& _contact, int64_t _from, int64_t _dep
 
                 if (_error == 0)
                 {
-                    ptr_this->get_archive()->validate_hole_request(_contact, *_hole, count)->on_result = [wr_this, _contact, depth_tail, _recursion, last_message_catcher](int64_t _from)
+                    ptr_this->get_archive()->validate_hole_request(_contact, *_hole, count)->on_result = [wr_this, _contact, depth_tail, _recursion, last_message_catcher, _chain](int64_t _from)
                     {
                         auto ptr_this = wr_this.lock();
                         if (!ptr_this)
                             return;
 
-                        ptr_this->download_holes(_contact, _from, depth_tail, (_recursion + 1), last_message_catcher);
+                        ptr_this->download_holes_chain(_contact, _from, depth_tail, (_recursion + 1), last_message_catcher, _chain);
 
                         return;
 
@@ -4101,27 +4552,16 @@ std::shared_ptr<async_task_handlers> im::post_dlg_state_to_gui(
             if (_state.get_hidden_msg_id() >= _state.get_last_msgid() && !_force)
                 return;
 
-            coll_helper cl_coll(g_core->create_collection(), true);
-            cl_coll.set<std::string>("contact", _contact);
-            cl_coll.set<std::string>("my_aimid", ptr_this->auth_params_->aimid_);
-            cl_coll.set<bool>("is_chat", _contact.find("@chat.agent") != _contact.npos);
-
-            if (ptr_this->favorites_->contains(_contact))
+            if (_add_to_active_dialogs && ptr_this->favorites_->contains(_contact) && !ptr_this->active_dialogs_->contains(_contact))
             {
-                cl_coll.set<int64_t>("favorite_time", ptr_this->favorites_->get_time(_contact));
-                if (_add_to_active_dialogs && !ptr_this->active_dialogs_->contains(_contact))
-                {
-                    active_dialog dlg(_contact);
-                    ptr_this->active_dialogs_->update(dlg);
-                }
+                active_dialog dlg(_contact);
+                ptr_this->active_dialogs_->update(dlg);
             }
 
-            _state.serialize(
-                cl_coll.get(),
-                ptr_this->auth_params_->time_offset_,
-                ptr_this->fetch_params_->last_successful_fetch_,
-                _serialize_message
-            );
+            coll_helper cl_coll(g_core->create_collection(), true);
+            ptr_this->serialize_dlg_state(_contact, _state, _serialize_message, cl_coll);
+
+            ptr_this->startup_snapshot_->update_state(_contact, _state);
 
             ptr_this->post_dlg_state_to_gui(cl_coll.get());
 
@@ -4132,6 +4572,46 @@ std::shared_ptr<async_task_handlers> im::post_dlg_state_to_gui(
     return handler;
 }
 
+void im::serialize_dlg_state(const std::string& _contact, const archive::dlg_state& _state, const bool _serialize_message, coll_helper& _coll)
+{
+    _coll.set<std::string>("contact", _contact);
+    _coll.set<std::string>("my_aimid", auth_params_->aimid_);
+    _coll.set<bool>("is_chat", _contact.find("@chat.agent") != _contact.npos);
+
+    if (favorites_->contains(_contact))
+        _coll.set<int64_t>("favorite_time", favorites_->get_time(_contact));
+
+    _state.serialize(
+        _coll.get(),
+        auth_params_->time_offset_,
+        fetch_params_->last_successful_fetch_,
+        _serialize_message
+    );
+}
+
+void im::post_startup_snapshot_to_gui()
+{
+    // posted at once, the archive states of the same dialogs follow when the active dialogs are loaded
+    for (const auto& aimid : startup_snapshot_->get_recents())
+    {
+        const auto state = startup_snapshot_->get_state(aimid);
+        if (!state || contact_list_->is_ignored(aimid))
+            continue;
+
+        if (state->get_hidden_msg_id() >= state->get_last_msgid())
+            continue;
+
+        coll_helper cl_coll(g_core->create_collection(), true);
+        serialize_dlg_state(aimid, *state, true, cl_coll);
+
+        cached_dlg_states_.push_back(cl_coll.get());
+
+        cl_coll->addref();
+    }
+
+    post_cached_dlg_states_to_gui();
+}
+
 void im::check_need_agregate_dlg_state()
 {
     const auto current_time = std::chrono::system_clock::now();
@@ -4939,8 +5419,7 @@ void im::history_search_in_cl(const std::vector<std::vector<std::string>>& searc
     if (!pattern.empty())
     {
         post(contact_list_->search(pattern, true, 0, fixed_patterns_count));
-        if (g_core->end_search() == 0)
-            contact_list_->last_search_patterns_ = pattern;
+        g_core->end_search();
         return;
     }
     
@@ -4984,9 +5463,9 @@ void im::history_search_in_history(const std::string& term, const std::vector<st
 
     if (_aimids.empty())
     {
-        for (auto item : contact_list_->contacts_index_)
+        for (const auto& aimid : contact_list_->get_aimids())
         {
-            search_data_.contact_and_offset.push_back(std::make_pair(std::make_pair(item.second->aimid_, std::make_shared<int64_t>(0)), std::make_shared<int64_t>(0)));
+            search_data_.contact_and_offset.push_back(std::make_pair(std::make_pair(aimid, std::make_shared<int64_t>(0)), std::make_shared<int64_t>(0)));
         }
     }
     else
@@ -5784,6 +6263,9 @@ void im::post_not_sent_message_to_gui(int64_t _seq, const archive::not_sent_mess
 void im::add_opened_dialog(const std::string& _contact)
 {
     opened_dialogs_.insert(std::make_pair(_contact, archive::opened_dialog()));
+
+    // a queued request of the dialog may take the reserved slot now
+    run_holes_scheduler();
 }
 
 void im::remove_opened_dialog(const std::string& _contact)
@@ -14,6 +14,8 @@
 #define	ROBUSTO_THREAD_COUNT	3
 #endif //_DEBUG
 
+#define	WIM_SEND_THREAD_COUNT	4
+
 namespace voip_manager{
     struct VoipProtoMsg;
 }
@@ -68,6 +70,8 @@ namespace core
         typedef std::vector<std::pair<std::pair<std::string, std::shared_ptr<int64_t>>, std::shared_ptr<int64_t>>> contact_and_offsets;
 
         struct coded_term;
+
+        class dlg_state;
     }
 
     namespace themes
@@ -117,14 +121,17 @@ namespace core
         class async_loader;
         class send_message;
         class fetch;
+        class fetch_pacer;
         class chat_params;
         class mailbox_storage;
         class snaps_storage;
+        class startup_snapshot;
 
         namespace holes
         {
             class request;
             class failed_requests;
+            class scheduler;
         }
 
 
@@ -138,6 +145,8 @@ namespace core
         //////////////////////////////////////////////////////////////////////////
         // wim_send_thread
         //////////////////////////////////////////////////////////////////////////
+        // packets of one send queue (wim_packet::get_send_queue) are executed one by one in the order
+        // they were posted, packets of different queues are executed in parallel
         class wim_send_thread : public async_executer, public std::enable_shared_from_this<wim_send_thread>
         {
             struct task_and_params
@@ -145,6 +154,7 @@ namespace core
                 std::shared_ptr<wim_packet> task_;
                 std::function<void(int32_t)> error_handler_;
                 std::shared_ptr<async_task_handlers> callback_handlers_;
+                std::chrono::system_clock::time_point post_time_;
 
                 task_and_params(
                     std::shared_ptr<wim_packet> _task,
@@ -153,15 +163,48 @@ namespace core
                     :
                 task_(_task),
                     error_handler_(_error_handler),
-                    callback_handlers_(_callback_handlers) {}
+                    callback_handlers_(_callback_handlers),
+                    post_time_(std::chrono::system_clock::now()) {}
+            };
+
+            struct send_queue
+            {
+                uint32_t packets_in_flight_;
+                std::list<task_and_params> packets_;
+
+                send_queue() : packets_in_flight_(0) {}
+            };
+
+            struct packet_stats
+            {
+                uint32_t sent_;
+                uint32_t max_queue_depth_;
+                std::chrono::milliseconds wait_time_;
+                std::chrono::milliseconds execute_time_;
+
+                packet_stats() : sent_(0), max_queue_depth_(0), wait_time_(0), execute_time_(0) {}
             };
 
-            bool is_packet_execute_;
-            std::list<task_and_params> packets_queue_;
+            std::map<std::string, send_queue> queues_;
+
+            // a queue without a limit sends its packets one by one, so they stay in order
+            std::map<std::string, uint32_t> queue_limits_;
+
+            uint32_t packets_in_flight_;
+            uint32_t max_packets_in_flight_;
+
+            // by packet name
+            std::map<std::string, packet_stats> stats_;
+            std::chrono::system_clock::time_point stats_log_time_;
 
             std::chrono::system_clock::time_point cancel_packets_time_;
 
-            void execute_packet_from_queue();
+            uint32_t get_queue_limit(const std::string& _queue) const;
+
+            void execute_packets_from_queues();
+            void execute_packet(const std::string& _queue, const task_and_params& _task);
+            void run_packet(const std::string& _queue, const task_and_params& _task, std::chrono::system_clock::time_point _start_time);
+            void on_packet_finished(const std::string& _queue, const task_and_params& _task, std::chrono::system_clock::time_point _start_time);
 
             std::shared_ptr<async_task_handlers> post_packet(
                 std::shared_ptr<wim_packet> _packet,
@@ -173,6 +216,11 @@ namespace core
             std::shared_ptr<async_task_handlers> post_packet(std::shared_ptr<wim_packet> _packet, std::function<void(int32_t)> _error_handler);
             void clear();
 
+            void set_max_packets_in_flight(uint32_t _count);
+            void set_queue_limit(const std::string& _queue, uint32_t _count);
+
+            void log_stats() const;
+
             wim_send_thread();
             virtual ~wim_send_thread();
         };
@@ -281,6 +329,7 @@ namespace core
             std::shared_ptr<wim::favorites> favorites_;
             std::shared_ptr<wim::mailbox_storage> mailbox_storage_;
             std::shared_ptr<wim::snaps_storage> snaps_storage_;
+            std::shared_ptr<wim::startup_snapshot> startup_snapshot_;
 
             // authorization parameters
             std::shared_ptr<auth_parameters> auth_params_;
@@ -288,6 +337,7 @@ namespace core
 
             // wim fetch parameters
             std::shared_ptr<fetch_parameters> fetch_params_;
+            std::shared_ptr<fetch_pacer> fetch_pacer_;
 
             // temporary for phone registration
             std::shared_ptr<phone_info> phone_registration_data_;
@@ -322,6 +372,8 @@ namespace core
             std::map<std::string, archive::opened_dialog> opened_dialogs_;
 
             std::shared_ptr<holes::failed_requests> failed_holes_requests_;
+            std::shared_ptr<holes::scheduler> holes_scheduler_;
+            std::chrono::steady_clock::time_point holes_progress_post_time_;
 
             bool sent_pending_messages_active_;
 
@@ -374,7 +426,10 @@ namespace core
             void save_favorites();
             void save_mailboxes();
             void save_snaps_storage();
+            void save_dlg_states();
+            void save_startup_snapshot();
 
+            std::shared_ptr<async_task_handlers> load_startup_snapshot();
             std::shared_ptr<async_task_handlers> load_active_dialogs();
             std::shared_ptr<async_task_handlers> load_contact_list();
             std::shared_ptr<async_task_handlers> load_my_info();
@@ -385,11 +440,14 @@ namespace core
             // stickers
             void load_stickers_data(int64_t _seq, const std::string _size);
             void download_stickers(int64_t _seq, const std::string _size);
+            void download_next_sticker(int64_t _seq, const std::string& _size);
             void download_stickers_metadata(int64_t _seq, const std::string _size);
+            void download_next_stickers_metadata(int64_t _seq, const std::string& _size);
             void download_stickers_metafile(int64_t _seq, const std::string& _size, const std::string& _md5);
             virtual void get_stickers_meta(int64_t _seq, const std::string& _size) override;
             virtual void get_sticker(int64_t _seq, int32_t _set_id, int32_t _sticker_id, core::sticker_size _size) override;
             void post_stickers_meta_to_gui(int64_t _seq, const std::string& _size);
+            void post_stickers_download_progress_to_gui(int32_t _loaded, int32_t _total);
 
             virtual void get_chat_home(int64_t _seq, const std::string& _tag) override;
             virtual void get_chat_info(int64_t _seq, const std::string& _aimid, const std::string& _stamp, int32_t _limit) override;
@@ -419,6 +477,7 @@ namespace core
             void download_themes(int64_t _seq);
 
             void load_cached_objects();
+            void load_cached_objects_after_contact_list(std::shared_ptr<tools::auto_scope_bool> _call_on_exit);
             void save_cached_objects();
 
             void post_my_info_to_gui();
@@ -560,6 +619,9 @@ namespace core
 			void download_holes(const std::string& _contact, std::function<void(int64_t)> last_message_catcher);
 			void download_holes(const std::string& _contact, int64_t _depth = -1, std::function<void(int64_t)> last_message_catcher = [](int64_t){});
             void download_holes(const std::string& _contact, int64_t _from, int64_t _depth = -1, int32_t _recursion = 0, std::function<void(int64_t)> last_message_catcher = [](int64_t){});
+            void download_holes_chain(const std::string& _contact, int64_t _from, int64_t _depth, int32_t _recursion, std::function<void(int64_t)> last_message_catcher, std::shared_ptr<tools::auto_scope> _chain);
+            void run_holes_scheduler();
+            void post_holes_progress_to_gui();
 
             virtual std::string _get_protocol_uid() override;
 
@@ -586,6 +648,8 @@ namespace core
 
             void post_dlg_state_to_gui(core::icollection* _dlg_state);
             void post_cached_dlg_states_to_gui();
+            void post_startup_snapshot_to_gui();
+            void serialize_dlg_state(const std::string& _contact, const archive::dlg_state& _state, const bool _serialize_message, coll_helper& _coll);
             void stop_dlg_state_timer();
             void check_need_agregate_dlg_state();
 
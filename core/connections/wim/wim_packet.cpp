@@ -7,6 +7,10 @@
 #include "../../log/log.h"
 #include "../../utils.h"
 
+#ifndef _WIN32
+#include <cxxabi.h>
+#endif
+
 using namespace core;
 using namespace wim;
 
@@ -32,6 +36,35 @@ bool wim_packet::support_async_execution() const
     return false;
 }
 
+std::string wim_packet::get_send_queue() const
+{
+    return std::string();
+}
+
+std::string wim_packet::get_name() const
+{
+    std::string name = typeid(*this).name();
+
+#ifndef _WIN32
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+    if (demangled)
+    {
+        if (status == 0)
+            name = demangled;
+
+        free(demangled);
+    }
+#endif
+
+    // msvc returns "class core::wim::send_message"
+    const auto pos = name.find_last_of(": ");
+    if (pos != std::string::npos)
+        name = name.substr(pos + 1);
+
+    return name;
+}
+
 int32_t wim_packet::execute()
 {
     auto request = std::make_shared<core::http_request_simple>(params_.proxy_, utils::get_user_agent(), params_.stop_handler_);
@@ -252,6 +252,12 @@ namespace core
 
             virtual bool support_async_execution() const;
 
+            // the packets of one queue are sent in order, see wim_send_thread; the empty name is the common queue
+            virtual std::string get_send_queue() const;
+
+            // the class name without namespaces, the send statistics are kept by it
+            virtual std::string get_name() const;
+
             int32_t execute() override final;
             void execute_async(handler_t _handler);
 
@@ -25,6 +25,7 @@
 #include "archive/local_history.h"
 #include "log/log.h"
 #include "profiling/profiler.h"
+#include "profiling/timeline.h"
 #include "updater/updater.h"
 #include "crash_sender.h"
 #include "statistics.h"
@@ -63,6 +64,8 @@ core_dispatcher::core_dispatcher()
     search_count_.store(0);
 
     profiler::enable(::build::is_debug());
+
+    timeline::mark("core.created");
 }
 
 
@@ -72,6 +75,9 @@ core_dispatcher::~core_dispatcher()
 
     __LOG(log::shutdown();)
 
+    timeline::mark("shutdown.log_flushed");
+    timeline::save(utils::get_product_data_path() + L"/stats/timeline.stg", utils::get_logs_path().wstring() + L"/timeline.txt");
+
     curl_handler::instance().cleanup();
 
     http_request_simple::shutdown_global();
@@ -145,6 +151,8 @@ void core::core_dispatcher::link_gui(icore_interface* _core_face, const common::
 
 void core::core_dispatcher::start(const common::core_gui_settings& _settings)
 {
+    timeline::mark("core.start");
+
     __LOG(log::init(utils::get_logs_path(), false);)
 
     core_gui_settings_ = _settings;
@@ -175,6 +183,8 @@ void core::core_dispatcher::start(const common::core_gui_settings& _settings)
     load_theme_settings();
     load_hosts_config();
 
+    timeline::mark("core.settings_loaded");
+
     post_need_promo();
     post_theme_settings();
     post_gui_settings();
@@ -194,6 +204,8 @@ void core::core_dispatcher::start(const common::core_gui_settings& _settings)
 
     post_logins();
 
+    timeline::mark("core.im_created");
+
     updater_.reset(new update::updater());
 
 #ifdef _WIN32
@@ -203,11 +215,15 @@ void core::core_dispatcher::start(const common::core_gui_settings& _settings)
 #endif
 
     load_statistics();
+
+    timeline::mark("core.started");
 }
 
 
 void core::core_dispatcher::unlink_gui()
 {
+    timeline::mark("shutdown.unlink_gui");
+
     curl_handler::instance().stop();
 
     execute_core_context([this]
@@ -215,12 +231,15 @@ void core::core_dispatcher::unlink_gui()
         // NOTE : this order is important!
         voip_manager_.reset();
         im_container_.reset();
+        timeline::mark("shutdown.im_destroyed");
         gui_settings_.reset();
         scheduler_.reset();
         hosts_config_.reset();
         if (is_stats_enabled())
             statistics_.reset();
+        timeline::mark("shutdown.statistics_saved");
         save_thread_.reset();
+        timeline::mark("shutdown.save_thread_drained");
         updater_.reset();
         report_sender_.reset();
         network_log_.reset();
@@ -231,6 +250,8 @@ void core::core_dispatcher::unlink_gui()
     delete core_thread_;
     core_thread_ = nullptr;
 
+    timeline::mark("shutdown.core_thread_stopped");
+
     gui_connector_->release();
     gui_connector_ = nullptr;
 
@@ -547,6 +568,19 @@ void core::core_dispatcher::on_message_profiler_proc_stop(coll_helper _params) c
     profiler::process_stopped(id, ts);
 }
 
+void core::core_dispatcher::on_message_timeline_mark(coll_helper _params) const
+{
+    const auto phase = _params.get_value_as_string("phase");
+    const auto ts = _params.get_value_as_int64("ts");
+
+    timeline::mark(phase, ts);
+}
+
+void core::core_dispatcher::on_message_timeline_dump(coll_helper _params) const
+{
+    timeline::request_dump();
+}
+
 void core::core_dispatcher::receive_message_from_gui(const char * _message, int64_t _seq, icollection* _message_data)
 {
     // called from main thread
@@ -624,6 +658,14 @@ void core::core_dispatcher::receive_message_from_gui(const char * _message, int6
         {
             on_message_profiler_proc_stop(params);
         }
+        else if (message_string == "timeline/mark")
+        {
+            on_message_timeline_mark(params);
+        }
+        else if (message_string == "timeline/dump")
+        {
+            on_message_timeline_dump(params);
+        }
         else if (message_string == "themes/settings/set")
         {
             on_message_update_theme_settings_value(_seq, params);
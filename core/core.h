@@ -98,6 +98,8 @@ namespace core
         void on_message_log(coll_helper _params) const;
         void on_message_profiler_proc_start(coll_helper _params) const;
         void on_message_profiler_proc_stop(coll_helper _params) const;
+        void on_message_timeline_mark(coll_helper _params) const;
+        void on_message_timeline_dump(coll_helper _params) const;
 
         void post_data_path();
         void load_theme_settings();
@@ -72,7 +72,8 @@ bool core::curl_context::init(milliseconds_t _connect_timeout, milliseconds_t _t
     curl_easy_setopt(curl_, CURLOPT_TCP_KEEPINTVL, 5L);
     curl_easy_setopt(curl_, CURLOPT_NOSIGNAL, 1L);
 
-    curl_easy_setopt(curl_, CURLOPT_ACCEPT_ENCODING, "gzip");
+    // an empty list offers every encoding curl is built with (gzip, deflate), the body is inflated as it arrives
+    curl_easy_setopt(curl_, CURLOPT_ACCEPT_ENCODING, "");
 
     curl_easy_setopt(curl_, CURLOPT_USERAGENT, _user_agent.c_str());
 
@@ -14,12 +14,43 @@ enum gui_settings_types
     gst_value = 1
 };
 
+enum gui_settings_journal_records
+{
+    gsj_set = 1,
+    gsj_clear = 2
+};
+
+namespace
+{
+    const int64_t min_journal_size_to_compact = 256 * 1024;
+
+    bool append_to_file(const std::wstring& _file_name, tools::binary_stream& _data)
+    {
+        auto outfile = tools::system::open_file_for_write(_file_name, std::ofstream::binary | std::ofstream::app);
+        if (!outfile.is_open())
+            return false;
+
+        uint32_t size = _data.available();
+        if (size > 0)
+            outfile.write(_data.read(size), size);
+
+        outfile.flush();
+
+        return outfile.good();
+    }
+}
+
 gui_settings::gui_settings(
     const std::wstring& _file_name,
     const std::wstring& _file_name_exported)
     :	file_name_(_file_name),
         file_name_exported_(_file_name_exported),
-        changed_(false)
+        changed_(false),
+        timer_(0),
+        values_cleared_(false),
+        need_compact_(false),
+        file_size_(0),
+        journal_size_(0)
 {
 }
 
@@ -50,11 +81,93 @@ bool gui_settings::load()
 {
     core::tools::binary_stream bstream;
     if (bstream.load_from_file(file_name_))
-        return unserialize(bstream);
-    
+    {
+        file_size_ = bstream.available();
+
+        if (!unserialize(bstream))
+        {
+            need_compact_ = true;
+            return false;
+        }
+
+        load_journal();
+
+        return true;
+    }
+
+    need_compact_ = true;
+
     return load_exported();
 }
 
+std::wstring gui_settings::get_journal_file_name() const
+{
+    return file_name_ + L".journal";
+}
+
+bool gui_settings::load_journal()
+{
+    core::tools::binary_stream bstream;
+    if (!bstream.load_from_file(get_journal_file_name()))
+        return false;
+
+    journal_size_ = bstream.available();
+
+    while (bstream.available())
+    {
+        tools::tlv record;
+        if (!record.unserialize(bstream))
+        {
+            // the last append was interrupted, the next save rewrites the file without the torn record
+            need_compact_ = true;
+            return false;
+        }
+
+        switch (record.get_type())
+        {
+        case gui_settings_journal_records::gsj_set:
+            {
+                tools::binary_stream record_data = record.get_value<tools::binary_stream>();
+
+                tools::tlvpack pack;
+                if (!pack.unserialize(record_data))
+                {
+                    need_compact_ = true;
+                    return false;
+                }
+
+                auto tlv_name = pack.get_item(gui_settings_types::gst_name);
+                auto tlv_value_data = pack.get_item(gui_settings_types::gst_value);
+
+                if (!tlv_name || !tlv_value_data)
+                {
+                    assert(false);
+                    need_compact_ = true;
+                    return false;
+                }
+
+                values_[tlv_name->get_value<std::string>()] = tlv_value_data->get_value<tools::binary_stream>();
+
+                break;
+            }
+        case gui_settings_journal_records::gsj_clear:
+            {
+                values_.clear();
+
+                break;
+            }
+        default:
+            {
+                assert(false);
+                need_compact_ = true;
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
 bool gui_settings::load_exported()
 {
     core::tools::binary_stream bstream_exported;
@@ -79,6 +192,7 @@ bool gui_settings::load_exported()
 void gui_settings::set_value(const std::string& _name, const tools::binary_stream& _data)
 {
     values_[_name] = _data;
+    changed_values_.insert(_name);
     changed_ = true;
 }
 
@@ -245,22 +359,93 @@ void gui_settings::save_if_needed()
     {
         changed_ = false;
 
-        auto bs_data = std::make_shared<tools::binary_stream>();
-        serialize(*bs_data);
+        if (need_compact_ || journal_size_ > std::max(file_size_, min_journal_size_to_compact))
+            compact();
+        else
+            append_journal();
+    }
+}
 
-        std::wstring file_name = file_name_;
+std::shared_ptr<tools::binary_stream> gui_settings::make_journal_records()
+{
+    auto bs_data = std::make_shared<tools::binary_stream>();
 
-        g_core->save_async([bs_data, file_name]
-        { 
-            bs_data->save_2_file(file_name);
+    if (values_cleared_)
+        tools::tlv(gui_settings_journal_records::gsj_clear, tools::binary_stream()).serialize(*bs_data);
+
+    for (const auto& name : changed_values_)
+    {
+        auto iter = values_.find(name);
+        if (iter == values_.end())
+            continue;
 
-            return 0;
-        });
+        tools::tlvpack value_tlv;
+        value_tlv.push_child(tools::tlv(gui_settings_types::gst_name, iter->first));
+        value_tlv.push_child(tools::tlv(gui_settings_types::gst_value, iter->second));
+
+        tools::binary_stream bs_value;
+        value_tlv.serialize(bs_value);
+        tools::tlv(gui_settings_journal_records::gsj_set, bs_value).serialize(*bs_data);
     }
+
+    changed_values_.clear();
+    values_cleared_ = false;
+
+    return bs_data;
+}
+
+void gui_settings::append_journal()
+{
+    auto bs_data = make_journal_records();
+
+    journal_size_ += bs_data->available();
+
+    std::wstring file_name = get_journal_file_name();
+
+    // the save thread is single, so the appends and the rewrites reach the disk in the order they were made
+    g_core->save_async([bs_data, file_name]
+    {
+        return (append_to_file(file_name, *bs_data) ? 0 : -1);
+    });
+}
+
+void gui_settings::compact()
+{
+    // the pending changes go to the journal first: if the journal outlives the new file,
+    // its last records hold the newest values and replaying it over the new file gives the same values
+    auto bs_journal = make_journal_records();
+
+    auto bs_data = std::make_shared<tools::binary_stream>();
+    serialize(*bs_data);
+
+    need_compact_ = false;
+
+    file_size_ = bs_data->available();
+    journal_size_ = 0;
+
+    std::wstring file_name = file_name_;
+    std::wstring journal_file_name = get_journal_file_name();
+
+    g_core->save_async([bs_journal, bs_data, file_name, journal_file_name]
+    {
+        if (!append_to_file(journal_file_name, *bs_journal))
+            return -1;
+
+        // save_2_file replaces the file through a temporary one
+        if (!bs_data->save_2_file(file_name))
+            return -1;
+
+        tools::system::delete_file(journal_file_name);
+
+        return 0;
+    });
 }
 
 void gui_settings::clear_values()
 {
     values_.clear();
+    changed_values_.clear();
+    values_cleared_ = true;
+    need_compact_ = true;
     changed_ = true;
 }
\ No newline at end of file
@@ -16,7 +16,23 @@ namespace core
         bool changed_;
         uint32_t timer_;
 
+        // the changes since the last save are appended to the journal file next to file_name_,
+        // the whole file is rewritten only when the journal outgrows it
+        std::set<std::string> changed_values_;
+        bool values_cleared_;
+        bool need_compact_;
+
+        int64_t file_size_;
+        int64_t journal_size_;
+
         bool load_exported();
+        bool load_journal();
+
+        std::wstring get_journal_file_name() const;
+
+        std::shared_ptr<tools::binary_stream> make_journal_records();
+        void append_journal();
+        void compact();
 
     public:
 
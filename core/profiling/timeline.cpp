@@ -0,0 +1,282 @@
+#include "stdafx.h"
+
+#include "timeline.h"
+
+#include "../tools/binary_stream.h"
+#include "../tools/tlv.h"
+#include "../../common.shared/version_info.h"
+
+using namespace core;
+using namespace tools;
+
+enum timeline_fields
+{
+    tf_version = 1,
+    tf_started = 2,
+    tf_phases = 3,
+
+    tf_phase_name = 1,
+    tf_phase_time = 2
+};
+
+namespace
+{
+    const size_t max_runs_count = 20;
+
+    struct phase_info
+    {
+        std::string name_;
+
+        // ms from the start of the run
+        int64_t time_;
+    };
+
+    struct run_info
+    {
+        std::string version_;
+
+        int64_t started_;
+
+        std::vector<phase_info> phases_;
+
+        run_info() : started_(0) {}
+    };
+
+    std::mutex timeline_mutex_;
+
+    // in the order they were reached
+    std::vector<std::pair<std::string, int64_t>> phases_;
+
+    bool is_dump_requested_ = false;
+
+    int64_t now_ms()
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    void serialize_run(const run_info& _run, tlvpack& _pack)
+    {
+        _pack.push_child(tlv(timeline_fields::tf_version, _run.version_));
+        _pack.push_child(tlv(timeline_fields::tf_started, _run.started_));
+
+        tlvpack phases_pack;
+
+        uint32_t counter = 0;
+
+        for (const auto& phase : _run.phases_)
+        {
+            tlvpack phase_pack;
+            phase_pack.push_child(tlv(timeline_fields::tf_phase_name, phase.name_));
+            phase_pack.push_child(tlv(timeline_fields::tf_phase_time, phase.time_));
+
+            binary_stream phase_data;
+            phase_pack.serialize(phase_data);
+
+            phases_pack.push_child(tlv(++counter, phase_data));
+        }
+
+        binary_stream phases_data;
+        phases_pack.serialize(phases_data);
+
+        _pack.push_child(tlv(timeline_fields::tf_phases, phases_data));
+    }
+
+    bool unserialize_run(tlvpack& _pack, run_info& _run)
+    {
+        auto tlv_version = _pack.get_item(timeline_fields::tf_version);
+        auto tlv_started = _pack.get_item(timeline_fields::tf_started);
+        auto tlv_phases = _pack.get_item(timeline_fields::tf_phases);
+        if (!tlv_version || !tlv_started || !tlv_phases)
+            return false;
+
+        _run.version_ = tlv_version->get_value<std::string>();
+        _run.started_ = tlv_started->get_value<int64_t>();
+
+        tlvpack phases_pack;
+        if (!phases_pack.unserialize(tlv_phases->get_value<binary_stream>()))
+            return false;
+
+        for (auto tlv_phase = phases_pack.get_first(); tlv_phase; tlv_phase = phases_pack.get_next())
+        {
+            tlvpack phase_pack;
+            if (!phase_pack.unserialize(tlv_phase->get_value<binary_stream>()))
+                return false;
+
+            auto tlv_name = phase_pack.get_item(timeline_fields::tf_phase_name);
+            auto tlv_time = phase_pack.get_item(timeline_fields::tf_phase_time);
+            if (!tlv_name || !tlv_time)
+                return false;
+
+            phase_info phase;
+            phase.name_ = tlv_name->get_value<std::string>();
+            phase.time_ = tlv_time->get_value<int64_t>();
+
+            _run.phases_.push_back(phase);
+        }
+
+        return true;
+    }
+
+    std::vector<run_info> load_runs(const std::wstring& _file_name)
+    {
+        std::vector<run_info> runs;
+
+        binary_stream bs;
+        if (!bs.load_from_file(_file_name))
+            return runs;
+
+        tlvpack pack;
+        if (!pack.unserialize(bs))
+            return runs;
+
+        for (auto tlv_run = pack.get_first(); tlv_run; tlv_run = pack.get_next())
+        {
+            tlvpack run_pack;
+            if (!run_pack.unserialize(tlv_run->get_value<binary_stream>()))
+                break;
+
+            run_info run;
+            if (!unserialize_run(run_pack, run))
+                break;
+
+            runs.push_back(run);
+        }
+
+        return runs;
+    }
+
+    void save_runs(const std::vector<run_info>& _runs, const std::wstring& _file_name)
+    {
+        tlvpack pack;
+
+        uint32_t counter = 0;
+
+        for (const auto& run : _runs)
+        {
+            tlvpack run_pack;
+            serialize_run(run, run_pack);
+
+            binary_stream run_data;
+            run_pack.serialize(run_data);
+
+            pack.push_child(tlv(++counter, run_data));
+        }
+
+        binary_stream bs;
+        pack.serialize(bs);
+
+        bs.save_2_file(_file_name);
+    }
+
+    void dump_runs(const std::vector<run_info>& _runs, const std::wstring& _file_name)
+    {
+        binary_stream bs;
+
+        for (const auto& run : _runs)
+        {
+            const time_t started = (time_t) (run.started_ / 1000);
+
+            tm started_tm = { 0 };
+#ifdef _WIN32
+            localtime_s(&started_tm, &started);
+#else
+            localtime_r(&started, &started_tm);
+#endif
+            std::stringstream ss_run;
+            ss_run << "run " << std::put_time<char>(&started_tm, "%Y-%m-%d %H:%M:%S") << ", version " << run.version_ << "\r\n";
+
+            int64_t previous = 0;
+
+            for (const auto& phase : run.phases_)
+            {
+                ss_run << (boost::format("    %-32s %8d ms  (+%d)\r\n") % phase.name_ % phase.time_ % (phase.time_ - previous));
+
+                previous = phase.time_;
+            }
+
+            ss_run << "\r\n";
+
+            bs.write<std::string>(ss_run.str());
+        }
+
+        bs.save_2_file(_file_name);
+    }
+}
+
+namespace core
+{
+    namespace timeline
+    {
+
+        void mark(const std::string& _phase)
+        {
+            mark(_phase, now_ms());
+        }
+
+        void mark(const std::string& _phase, const int64_t _ts)
+        {
+            assert(!_phase.empty());
+
+            std::lock_guard<std::mutex> lock(timeline_mutex_);
+
+            for (const auto& phase : phases_)
+            {
+                if (phase.first == _phase)
+                    return;
+            }
+
+            phases_.emplace_back(_phase, _ts);
+        }
+
+        void request_dump()
+        {
+            std::lock_guard<std::mutex> lock(timeline_mutex_);
+
+            is_dump_requested_ = true;
+        }
+
+        void save(const std::wstring& _file_name, const std::wstring& _dump_file_name)
+        {
+            std::unique_lock<std::mutex> lock(timeline_mutex_);
+
+            if (phases_.empty())
+                return;
+
+            auto phases = phases_;
+            const auto is_dump_requested = is_dump_requested_;
+
+            lock.unlock();
+
+            // the gui marks may come later than the core ones, the run starts with the earliest
+            std::stable_sort(phases.begin(), phases.end(), [](const std::pair<std::string, int64_t>& _first, const std::pair<std::string, int64_t>& _second)
+            {
+                return _first.second < _second.second;
+            });
+
+            run_info run;
+            run.version_ = version_info().get_version();
+            run.started_ = phases.front().second;
+
+            for (const auto& phase : phases)
+            {
+                phase_info info;
+                info.name_ = phase.first;
+                info.time_ = phase.second - run.started_;
+
+                run.phases_.push_back(info);
+            }
+
+            auto runs = load_runs(_file_name);
+            runs.push_back(run);
+
+            if (runs.size() > max_runs_count)
+                runs.erase(runs.begin(), runs.begin() + (runs.size() - max_runs_count));
+
+            save_runs(runs, _file_name);
+
+            if (is_dump_requested)
+                dump_runs(runs, _dump_file_name);
+        }
+
+    }
+}
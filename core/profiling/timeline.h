@@ -0,0 +1,24 @@
+#pragma once
+
+namespace core
+{
+
+    // the startup and shutdown phases of a run, core and gui together;
+    // a phase keeps the time it was reached first, the runs are stored with the version,
+    // so a regression shows against the previous runs
+    namespace timeline
+    {
+
+        void mark(const std::string& _phase);
+
+        void mark(const std::string& _phase, const int64_t _ts);
+
+        // the kept runs are written as text when the current one is saved
+        void request_dump();
+
+        // appends the current run to _file_name (the last runs are kept) and writes the dump if it was requested
+        void save(const std::wstring& _file_name, const std::wstring& _dump_file_name);
+
+    }
+
+}
@@ -37,6 +37,9 @@ namespace core
 
         const std::wstring stickers_meta_file_name = L"meta.js";
 
+        const int32_t max_meta_workers = 2;
+        const int32_t max_sticker_workers = 4;
+
         //////////////////////////////////////////////////////////////////////////
         // class sticker_params
         //////////////////////////////////////////////////////////////////////////
@@ -459,6 +462,13 @@ namespace core
 
         void cache::make_download_tasks()
         {
+            // the files already on disk are skipped, so a pack interrupted halfway is resumed from the missing stickers
+            std::set<std::string> queued;
+            for (const auto& task : meta_tasks_)
+                queued.insert(task.get_source_url());
+            for (const auto& task : stickers_tasks_)
+                queued.insert(task.get_source_url());
+
             for (auto iter = sets_.cbegin(); iter != sets_.cend(); ++iter)
             {
                 if (!(*iter)->is_show())
@@ -469,7 +479,7 @@ namespace core
                 for (auto iter_icon = icons.cbegin(); iter_icon != icons.cend(); iter_icon++)
                 {
                     std::wstring icon_file = get_set_icon_path(*(*iter), iter_icon->second);
-                    if (!core::tools::system::is_exist(icon_file))
+                    if (!core::tools::system::is_exist(icon_file) && queued.insert(iter_icon->second.get_url()).second)
                         meta_tasks_.push_back(download_task(iter_icon->second.get_url(), icon_file));
                 }
 
@@ -490,7 +500,7 @@ namespace core
 
                         std::wstring file_name = get_sticker_path(*(*iter), *(*iter_sticker), iter_size->second.get_size());
 
-                        if (!core::tools::system::is_exist(file_name))
+                        if (!core::tools::system::is_exist(file_name) && queued.insert(ss_url.str()).second)
                         {
                             if (has_gui_request(set_id, sticker_id))
                             {
@@ -504,6 +514,8 @@ namespace core
                     }
                 }
             }
+
+            progress_.total_ = progress_.loaded_ + (int32_t) stickers_tasks_.size();
         }
 
         void cache::serialize_meta_sync(coll_helper _coll, const std::string& _size)
@@ -573,24 +585,29 @@ namespace core
         }
 
 
-        bool cache::get_next_meta_task(download_task& _task)
+        bool cache::get_next_task(const download_tasks& _tasks, download_task& _task)
         {
-            if (meta_tasks_.empty())
-                return false;
+            // the tasks requested by gui are in the front of the list
+            for (const auto& task : _tasks)
+            {
+                if (active_tasks_.insert(task.get_source_url()).second)
+                {
+                    _task = task;
+                    return true;
+                }
+            }
 
-            _task = meta_tasks_.front();
-            
-            return true;
+            return false;
         }
 
-        bool cache::get_next_sticker_task(download_task& _task)
+        bool cache::get_next_meta_task(download_task& _task)
         {
-            if (stickers_tasks_.empty())
-                return false;
-
-            _task = stickers_tasks_.front();
+            return get_next_task(meta_tasks_, _task);
+        }
 
-            return true;
+        bool cache::get_next_sticker_task(download_task& _task)
+        {
+            return get_next_task(stickers_tasks_, _task);
         }
 
         void cache::get_sticker(int64_t _seq, int32_t _set_id, int32_t _sticker_id, const sticker_size _size, tools::binary_stream& _data)
@@ -657,6 +674,8 @@ namespace core
 
         bool cache::sticker_loaded(const download_task& _task, /*out*/ requests_list& _requests)
         {
+            active_tasks_.erase(_task.get_source_url());
+
             for (auto iter = stickers_tasks_.begin(); iter != stickers_tasks_.end(); ++iter)
             {
                 if (_task.get_source_url() == iter->get_source_url())
@@ -666,7 +685,9 @@ namespace core
                     clear_sticker_gui_requests(_task.get_set_id(), _task.get_sticker_id());
 
                     stickers_tasks_.erase(iter);
-                    
+
+                    ++progress_.loaded_;
+
                     return true;
                 }
             }
@@ -675,6 +696,8 @@ namespace core
 
         bool cache::meta_loaded(const download_task& _task)
         {
+            active_tasks_.erase(_task.get_source_url());
+
             for (auto iter = meta_tasks_.begin(); iter != meta_tasks_.end(); ++iter)
             {
                 if (_task.get_source_url() == iter->get_source_url())
@@ -686,6 +709,17 @@ namespace core
             return false;
         }
 
+        void cache::task_failed(const download_task& _task)
+        {
+            // the task stays in the queue and is picked up again on resume
+            active_tasks_.erase(_task.get_source_url());
+        }
+
+        download_progress cache::get_download_progress() const
+        {
+            return progress_;
+        }
+
        
 
 
@@ -702,7 +736,9 @@ namespace core
                 error_(loader_errors::success),
                 failed_step_(failed_step::ok),
                 up_to_date_(false),
-                download_in_progress_(true)
+                download_in_progress_(true),
+                meta_workers_(0),
+                sticker_workers_(0)
         {
         }
 
@@ -880,19 +916,24 @@ namespace core
             return handler;
         }
 
-        std::shared_ptr<result_handler<bool, const std::list<int64_t>&>> face::on_sticker_loaded(const download_task& _task)
+        std::shared_ptr<result_handler<bool, const requests_list&, const download_progress&>> face::on_sticker_loaded(const download_task& _task)
         {
-            auto handler = std::make_shared<result_handler<bool, const std::list<int64_t>&>>();
+            auto handler = std::make_shared<result_handler<bool, const requests_list&, const download_progress&>>();
             auto stickers_cache = cache_;
-            auto requests = std::make_shared<std::list<int64_t>>();
-            
-            thread_->run_async_function([stickers_cache, _task, requests]()->int32_t
+            auto requests = std::make_shared<requests_list>();
+            auto progress = std::make_shared<download_progress>();
+
+            thread_->run_async_function([stickers_cache, _task, requests, progress]()->int32_t
             {
-                return (stickers_cache->sticker_loaded(_task, *requests) ? 0 : -1);
+                const auto res = stickers_cache->sticker_loaded(_task, *requests);
+
+                *progress = stickers_cache->get_download_progress();
 
-            })->on_result_ = [handler, requests](int32_t _error)
+                return (res ? 0 : -1);
+
+            })->on_result_ = [handler, requests, progress](int32_t _error)
             {
-                handler->on_result_((_error == 0), *requests);
+                handler->on_result_((_error == 0), *requests, *progress);
             };
 
             return handler;
@@ -915,6 +956,24 @@ namespace core
             return handler;
         }
 
+        std::shared_ptr<result_handler<bool>> face::on_task_failed(const download_task& _task)
+        {
+            auto handler = std::make_shared<result_handler<bool>>();
+            auto stickers_cache = cache_;
+
+            thread_->run_async_function([stickers_cache, _task]()->int32_t
+            {
+                stickers_cache->task_failed(_task);
+                return 0;
+
+            })->on_result_ = [handler](int32_t _error)
+            {
+                handler->on_result_(_error == 0);
+            };
+
+            return handler;
+        }
+
         std::shared_ptr<result_handler<const std::string&>> face::get_md5()
         {
             auto handler = std::make_shared<result_handler<const std::string&>>();
@@ -994,6 +1053,38 @@ namespace core
         {
             download_in_progress_ = _in_progress;
         }
+
+        bool face::add_meta_worker()
+        {
+            if (meta_workers_ >= max_meta_workers)
+                return false;
+
+            ++meta_workers_;
+            return true;
+        }
+
+        bool face::remove_meta_worker()
+        {
+            assert(meta_workers_ > 0);
+
+            return (--meta_workers_ == 0);
+        }
+
+        bool face::add_sticker_worker()
+        {
+            if (sticker_workers_ >= max_sticker_workers)
+                return false;
+
+            ++sticker_workers_;
+            return true;
+        }
+
+        bool face::remove_sticker_worker()
+        {
+            assert(sticker_workers_ > 0);
+
+            return (--sticker_workers_ == 0);
+        }
     }
 }
 
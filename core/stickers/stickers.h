@@ -209,6 +209,14 @@ namespace core
         typedef std::list<download_task> download_tasks;
         typedef std::list<int64_t> requests_list;
 
+        struct download_progress
+        {
+            int32_t loaded_;
+            int32_t total_;
+
+            download_progress() : loaded_(0), total_(0) {}
+        };
+
         //////////////////////////////////////////////////////////////////////////
         // class cache
         //////////////////////////////////////////////////////////////////////////
@@ -221,6 +229,13 @@ namespace core
             download_tasks meta_tasks_;
             download_tasks stickers_tasks_;
 
+            // source urls of the tasks which are being downloaded now
+            std::set<std::string> active_tasks_;
+
+            download_progress progress_;
+
+            bool get_next_task(const download_tasks& _tasks, download_task& _task);
+
             typedef std::map<int32_t, requests_list> stickers_ids_list;
 
             typedef std::map<int32_t, stickers_ids_list> stickers_sets_ids_list;
@@ -254,6 +269,8 @@ namespace core
             std::string get_md5() const;
             bool sticker_loaded(const download_task& _task, /*out*/ requests_list&);
             bool meta_loaded(const download_task& _task);
+            void task_failed(const download_task& _task);
+            download_progress get_download_progress() const;
         };
 
         struct gui_request_params
@@ -288,6 +305,9 @@ namespace core
 
             bool download_in_progress_;
 
+            int32_t meta_workers_;
+            int32_t sticker_workers_;
+
             loader_errors error_;
             failed_step failed_step_;
 
@@ -311,8 +331,9 @@ namespace core
                 const core::sticker_size _size);
             std::shared_ptr<result_handler<bool, const download_task&>> get_next_meta_task();
             std::shared_ptr<result_handler<bool, const download_task&>> get_next_sticker_task();
-            std::shared_ptr<result_handler<bool, const requests_list&>> on_sticker_loaded(const download_task& _task);
+            std::shared_ptr<result_handler<bool, const requests_list&, const download_progress&>> on_sticker_loaded(const download_task& _task);
             std::shared_ptr<result_handler<bool>> on_metadata_loaded(const download_task& _task);
+            std::shared_ptr<result_handler<bool>> on_task_failed(const download_task& _task);
             std::shared_ptr<result_handler<const std::string&>> get_md5();
 
             void set_meta_requested();
@@ -332,6 +353,13 @@ namespace core
 
             bool is_download_in_progress();
             void set_download_in_progress(bool _in_progress);
+
+            // every worker downloads one file at a time, the number of workers bounds the parallel transfers;
+            // remove_*_worker returns true for the last worker of the step
+            bool add_meta_worker();
+            bool remove_meta_worker();
+            bool add_sticker_worker();
+            bool remove_sticker_worker();
         };
     }
 }
\ No newline at end of file
@@ -4,8 +4,7 @@
 
 void core::theme_settings::set_value(const std::string& _name, const tools::binary_stream& _data)
 {
-    values_[_name] = _data;
-    changed_ = true;
+    gui_settings::set_value(_name, _data);
 }
 
 void core::theme_settings::set_value(const std::string& _name, const themes::theme& _theme)
@@ -15,25 +15,20 @@ settings::~settings()
 
 void core::tools::settings::serialize(binary_stream& bstream) const
 {
-    tlvpack pack;
-
+    // the same layout as a tlvpack of the values
     for (auto iter = values_.begin(); iter != values_.end(); iter++)
-        pack.push_child(iter->second);
-
-    pack.serialize(bstream);
+        iter->second.serialize(bstream);
 }
 
 bool core::tools::settings::unserialize(binary_stream& bstream)
 {
-    tlvpack pack;
-    if (!pack.unserialize(bstream))
-        return false;
-
-    auto val = pack.get_first();
-    while (val)
+    while (bstream.available())
     {
-        values_[val->get_type()] = val;
-        val = pack.get_next();
+        tlv val;
+        if (!val.unserialize(bstream))
+            return false;
+
+        values_[val.get_type()] = val;
     }
 
     return true;
@@ -46,7 +41,7 @@ template <>
             if (iter == values_.end())
                 return _default_value;
 
-            return iter->second->get_value<tools::binary_stream>();
+            return iter->second.get_value<tools::binary_stream>();
         }
 
 bool core::tools::settings::value_exists(uint32_t _value_key) const
@@ -13,7 +13,8 @@ namespace core
 
         class settings
         {
-            typedef std::map<uint32_t, std::shared_ptr<core::tools::tlv>> values_map;
+            // the values are kept in place, a setting costs one map node and no separate tlv allocation
+            typedef std::map<uint32_t, core::tools::tlv> values_map;
 
             values_map	values_;
 
@@ -40,10 +41,10 @@ namespace core
         template <class T_>
         void settings::set_value(uint32_t _value_key, T_ _value)
         {
-            auto value_tlv = std::make_shared<core::tools::tlv>();
-            value_tlv->set_value(_value);
-            value_tlv->set_type(_value_key);
-            values_[_value_key] = value_tlv;
+            auto& value_tlv = values_[_value_key];
+            value_tlv = core::tools::tlv();
+            value_tlv.set_value(_value);
+            value_tlv.set_type(_value_key);
         }
 
         template <class T_>
@@ -53,7 +54,7 @@ namespace core
             if (iter == values_.end())
                 return _default_value;
 
-            return iter->second->get_value(_default_value);
+            return iter->second.get_value(_default_value);
         }
 
         template <>
@@ -72,7 +73,7 @@ namespace core
             if (iter == values_.end())
                 return false;
 
-            *_value = iter->second->get_value<T_>();
+            *_value = iter->second.get_value<T_>();
 
             return true;
         }
@@ -48,8 +48,11 @@ SOURCES += \
     ../../core/connections/wim/auth_parameters.cpp \
     ../../core/connections/wim/avatar_loader.cpp \
     ../../core/connections/wim/chat_info.cpp \
+    ../../core/connections/wim/contact_search_index.cpp \
+    ../../core/connections/wim/contact_store.cpp \
     ../../core/connections/wim/my_info.cpp \
     ../../core/connections/wim/robusto_packet.cpp \
+    ../../core/connections/wim/startup_snapshot.cpp \
     ../../core/connections/wim/wim_contactlist_cache.cpp \
     ../../core/connections/wim/wim_history.cpp \
     ../../core/connections/wim/wim_im.cpp \
@@ -103,6 +106,7 @@ SOURCES += \
     ../../core/connections/wim/stat/imstat.cpp \
     ../../core/log/log.cpp \
     ../../core/profiling/profiler.cpp \
+    ../../core/profiling/timeline.cpp \
     ../../core/stickers/stickers.cpp \
     ../../core/tools/binary_stream.cpp \
     ../../core/tools/binary_stream_reader.cpp \
@@ -226,8 +230,11 @@ HEADERS += \
     ../../core/connections/wim/auth_parameters.h \
     ../../core/connections/wim/avatar_loader.h \
     ../../core/connections/wim/chat_info.h \
+    ../../core/connections/wim/contact_search_index.h \
+    ../../core/connections/wim/contact_store.h \
     ../../core/connections/wim/my_info.h \
     ../../core/connections/wim/robusto_packet.h \
+    ../../core/connections/wim/startup_snapshot.h \
     ../../core/connections/wim/wim_contactlist_cache.h \
     ../../core/connections/wim/wim_history.h \
     ../../core/connections/wim/wim_im.h \
@@ -283,6 +290,7 @@ HEADERS += \
     ../../core/connections/wim/stat/imstat.h \
     ../../core/log/log.h \
     ../../core/profiling/profiler.h \
+    ../../core/profiling/timeline.h \
     ../../core/stickers/stickers.h \
     ../../core/tools/binary_stream.h \
     ../../core/tools/binary_stream_reader.h \
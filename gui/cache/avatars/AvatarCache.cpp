@@ -0,0 +1,204 @@
+#include "stdafx.h"
+#include "AvatarCache.h"
+
+namespace Logic
+{
+	AvatarCacheStats::AvatarCacheStats()
+		: Hits_(0)
+		, Misses_(0)
+		, Evictions_(0)
+		, Bytes_(0)
+		, Budget_(0)
+		, Entries_(0)
+	{
+	}
+
+	AvatarCache::Entry::Entry(const Kind _kind, const QString& _key, const QPixmapSCptr& _pixmap, const int64_t _bytes)
+		: Kind_(_kind)
+		, Key_(_key)
+		, Pixmap_(_pixmap)
+		, Bytes_(_bytes)
+	{
+	}
+
+	AvatarCache::AvatarCache(const int64_t _budgetBytes, SourceEvictedCallback _onSourceEvicted)
+		: OnSourceEvicted_(std::move(_onSourceEvicted))
+	{
+		assert(_budgetBytes > 0);
+
+		Stats_.Budget_ = _budgetBytes;
+	}
+
+	QPixmapSCptr AvatarCache::Find(const Kind _kind, const QString& _key)
+	{
+		auto &index = GetIndex(_kind);
+
+		const auto iter = index.find(_key);
+		if (iter == index.end())
+		{
+			++Stats_.Misses_;
+			return nullptr;
+		}
+
+		++Stats_.Hits_;
+
+		Lru_.splice(Lru_.begin(), Lru_, iter->second);
+
+		return iter->second->Pixmap_;
+	}
+
+	bool AvatarCache::Contains(const Kind _kind, const QString& _key) const
+	{
+		const auto &index = GetIndex(_kind);
+
+		return (index.find(_key) != index.end());
+	}
+
+	void AvatarCache::Insert(const Kind _kind, const QString& _key, const QPixmapSCptr& _pixmap)
+	{
+		assert(!_key.isEmpty());
+		assert(_pixmap);
+
+		auto &index = GetIndex(_kind);
+
+		const auto bytes = GetPixmapBytes(*_pixmap);
+
+		const auto iter = index.find(_key);
+		if (iter != index.end())
+		{
+			auto &entry = *iter->second;
+
+			Stats_.Bytes_ += (bytes - entry.Bytes_);
+
+			entry.Pixmap_ = _pixmap;
+			entry.Bytes_ = bytes;
+
+			Lru_.splice(Lru_.begin(), Lru_, iter->second);
+		}
+		else
+		{
+			Lru_.emplace_front(_kind, _key, _pixmap, bytes);
+			index.emplace(_key, Lru_.begin());
+
+			Stats_.Bytes_ += bytes;
+			++Stats_.Entries_;
+		}
+
+		Shrink();
+	}
+
+	void AvatarCache::Remove(const Kind _kind, const QString& _key)
+	{
+		auto &index = GetIndex(_kind);
+
+		const auto iter = index.find(_key);
+		if (iter != index.end())
+		{
+			Erase(index, iter);
+		}
+	}
+
+	void AvatarCache::RemoveDerived(const QString& _aimId)
+	{
+		assert(!_aimId.isEmpty());
+
+		const auto prefix = (_aimId + '/');
+
+		RemoveByPrefix(Scaled_, prefix);
+		RemoveByPrefix(Rounded_, prefix);
+	}
+
+	void AvatarCache::SetBudget(const int64_t _budgetBytes)
+	{
+		assert(_budgetBytes > 0);
+
+		Stats_.Budget_ = _budgetBytes;
+
+		Shrink();
+	}
+
+	const AvatarCacheStats& AvatarCache::GetStats() const
+	{
+		return Stats_;
+	}
+
+	AvatarCache::Index& AvatarCache::GetIndex(const Kind _kind)
+	{
+		return const_cast<Index&>(static_cast<const AvatarCache*>(this)->GetIndex(_kind));
+	}
+
+	const AvatarCache::Index& AvatarCache::GetIndex(const Kind _kind) const
+	{
+		switch (_kind)
+		{
+			case Kind::Source:
+				return Sources_;
+
+			case Kind::Scaled:
+				return Scaled_;
+
+			case Kind::Rounded:
+				return Rounded_;
+		}
+
+		assert(!"unknown avatar cache kind");
+		return Sources_;
+	}
+
+	void AvatarCache::Erase(Index& _index, const Index::iterator _iter)
+	{
+		Stats_.Bytes_ -= _iter->second->Bytes_;
+		--Stats_.Entries_;
+
+		Lru_.erase(_iter->second);
+		_index.erase(_iter);
+	}
+
+	void AvatarCache::RemoveByPrefix(Index& _index, const QString& _prefix)
+	{
+		auto iter = _index.lower_bound(_prefix);
+
+		while ((iter != _index.end()) && iter->first.startsWith(_prefix))
+		{
+			auto next = std::next(iter);
+			Erase(_index, iter);
+			iter = next;
+		}
+	}
+
+	void AvatarCache::Shrink()
+	{
+		// the most recent entry is kept even if it alone exceeds the budget
+		while ((Stats_.Bytes_ > Stats_.Budget_) && (Lru_.size() > 1))
+		{
+			const auto &victim = Lru_.back();
+
+			const auto kind = victim.Kind_;
+			const auto key = victim.Key_;
+
+			auto &index = GetIndex(kind);
+
+			const auto iter = index.find(key);
+			assert(iter != index.end());
+
+			Erase(index, iter);
+
+			++Stats_.Evictions_;
+
+			if (kind == Kind::Source)
+			{
+				RemoveDerived(key);
+
+				if (OnSourceEvicted_)
+				{
+					OnSourceEvicted_(key);
+				}
+			}
+		}
+	}
+
+	int64_t AvatarCache::GetPixmapBytes(const QPixmap& _pixmap)
+	{
+		return ((int64_t)_pixmap.width() * _pixmap.height() * std::max(_pixmap.depth(), 8) / 8);
+	}
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+namespace Logic
+{
+	typedef std::shared_ptr<const QPixmap> QPixmapSCptr;
+
+	struct AvatarCacheStats
+	{
+		AvatarCacheStats();
+
+		int64_t Hits_;
+
+		int64_t Misses_;
+
+		int64_t Evictions_;
+
+		int64_t Bytes_;
+
+		int64_t Budget_;
+
+		int32_t Entries_;
+	};
+
+	// size-aware lru shared by the source, scaled and rounded avatar caches
+	class AvatarCache
+	{
+	public:
+		enum class Kind
+		{
+			Source,
+			Scaled,
+			Rounded
+		};
+
+		typedef std::function<void(const QString& _aimId)> SourceEvictedCallback;
+
+		AvatarCache(const int64_t _budgetBytes, SourceEvictedCallback _onSourceEvicted);
+
+		QPixmapSCptr Find(const Kind _kind, const QString& _key);
+
+		bool Contains(const Kind _kind, const QString& _key) const;
+
+		void Insert(const Kind _kind, const QString& _key, const QPixmapSCptr& _pixmap);
+
+		void Remove(const Kind _kind, const QString& _key);
+
+		void RemoveDerived(const QString& _aimId);
+
+		void SetBudget(const int64_t _budgetBytes);
+
+		const AvatarCacheStats& GetStats() const;
+
+	private:
+		struct Entry
+		{
+			Entry(const Kind _kind, const QString& _key, const QPixmapSCptr& _pixmap, const int64_t _bytes);
+
+			const Kind Kind_;
+
+			const QString Key_;
+
+			QPixmapSCptr Pixmap_;
+
+			int64_t Bytes_;
+		};
+
+		typedef std::list<Entry> EntryList;
+
+		typedef std::map<QString, EntryList::iterator> Index;
+
+		Index& GetIndex(const Kind _kind);
+
+		const Index& GetIndex(const Kind _kind) const;
+
+		void Erase(Index& _index, const Index::iterator _iter);
+
+		void RemoveByPrefix(Index& _index, const QString& _prefix);
+
+		void Shrink();
+
+		static int64_t GetPixmapBytes(const QPixmap& _pixmap);
+
+		EntryList Lru_;
+
+		Index Sources_;
+
+		Index Scaled_;
+
+		Index Rounded_;
+
+		AvatarCacheStats Stats_;
+
+		SourceEvictedCallback OnSourceEvicted_;
+	};
+}
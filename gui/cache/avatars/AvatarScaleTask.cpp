@@ -0,0 +1,51 @@
+#include "stdafx.h"
+
+#include "../../utils/utils.h"
+
+#include "AvatarScaleTask.h"
+
+namespace Logic
+{
+	AvatarScaleTask::AvatarScaleTask(const quint64 _ticket, const QImage& _source, const int _sizePx)
+		: Ticket_(_ticket)
+		, Source_(_source)
+		, SizePx_(_sizePx)
+		, Round_(false)
+		, IsDefault_(false)
+		, MiniIcons_(false)
+	{
+		assert(!Source_.isNull());
+		assert(SizePx_ > 0);
+	}
+
+	AvatarScaleTask::AvatarScaleTask(const quint64 _ticket, const QImage& _source, const int _sizePx, const QString& _state, const bool _isDefault, const bool _miniIcons)
+		: Ticket_(_ticket)
+		, Source_(_source)
+		, SizePx_(_sizePx)
+		, Round_(true)
+		, State_(_state)
+		, IsDefault_(_isDefault)
+		, MiniIcons_(_miniIcons)
+	{
+		assert(!Source_.isNull());
+		assert(SizePx_ > 0);
+	}
+
+	AvatarScaleTask::~AvatarScaleTask()
+	{
+	}
+
+	void AvatarScaleTask::run()
+	{
+		auto scaled = ((Source_.height() >= Source_.width())
+			? Source_.scaledToWidth(SizePx_, Qt::SmoothTransformation)
+			: Source_.scaledToHeight(SizePx_, Qt::SmoothTransformation));
+
+		if (Round_)
+		{
+			scaled = Utils::roundImage(scaled, State_, IsDefault_, MiniIcons_);
+		}
+
+		emit scaledSignal(Ticket_, scaled);
+	}
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+namespace Logic
+{
+	// the pixmaps are not touched here, the images are made pixmaps on the gui thread
+	class AvatarScaleTask
+		: public QObject
+		, public QRunnable
+	{
+		Q_OBJECT
+
+	Q_SIGNALS:
+		void scaledSignal(quint64 _ticket, QImage _result);
+
+	public:
+		AvatarScaleTask(const quint64 _ticket, const QImage& _source, const int _sizePx);
+
+		AvatarScaleTask(const quint64 _ticket, const QImage& _source, const int _sizePx, const QString& _state, const bool _isDefault, const bool _miniIcons);
+
+		virtual ~AvatarScaleTask();
+
+		void run();
+
+	private:
+		const quint64 Ticket_;
+
+		const QImage Source_;
+
+		const int SizePx_;
+
+		const bool Round_;
+
+		const QString State_;
+
+		const bool IsDefault_;
+
+		const bool MiniIcons_;
+	};
+}
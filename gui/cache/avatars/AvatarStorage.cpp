@@ -1,7 +1,10 @@
 #include "stdafx.h"
 #include "AvatarStorage.h"
 
+#include "AvatarScaleTask.h"
+
 #include "../../core_dispatcher.h"
+#include "../../gui_settings.h"
 #include "../../main_window/contact_list/ContactListModel.h"
 #include "../../main_window/history_control/HistoryControlPage.h"
 #include "../../utils/gui_coll_helper.h"
@@ -12,18 +15,39 @@ namespace
 {
 	QString CreateKey(const QString& _aimId, const int _sizePx);
 
+	QString CreatePendingKey(const Logic::AvatarCache::Kind _kind, const QString& _key);
+
+	QPixmap ScaleFast(const QPixmap& _avatar, const int _sizePx);
+
+	QPixmap RoundFast(const QPixmap& _avatar);
+
+	int64_t GetCacheBudgetFromSettings();
+
 	static int CLEANUP_TIMEOUT = 5 * 60 * 1000; //5min
 
     static int CREATE_TIMEOUT = 2 * 60 * 1000; //2min
 
     static int REQUEST_TIMEOUT = 15 * 1000; //15 sec
+
+	static int DEFAULT_CACHE_BUDGET_MB = 64;
 }
 
 namespace Logic
 {
+	AvatarStorage::PendingTask::PendingTask(const AvatarCache::Kind _kind, const QString& _key, const QString& _aimId)
+		: Kind_(_kind)
+		, Key_(_key)
+		, AimId_(_aimId)
+	{
+	}
+
 	AvatarStorage::AvatarStorage()
-		: Timer_(new QTimer(this))
+		: Cache_(GetCacheBudgetFromSettings(), [this](const QString& _aimId){ ForgetAvatar(_aimId); })
+		, NextTicket_(0)
+		, Timer_(new QTimer(this))
 	{
+		ScalePool_.setMaxThreadCount(std::max(1, QThread::idealThreadCount() / 2));
+
 		Timer_->setSingleShot(false);
 		Timer_->setInterval(CLEANUP_TIMEOUT);
 		Timer_->start();
@@ -32,13 +56,18 @@ namespace Logic
         connect(Ui::GetDispatcher(), SIGNAL(avatarUpdated(const QString &)), this, SLOT(UpdateAvatar(const QString &)), Qt::QueuedConnection);
         connect(Ui::GetDispatcher(), SIGNAL(chatInfo(qint64, std::shared_ptr<Data::ChatInfo>)), this, SLOT(chatInfo(qint64, std::shared_ptr<Data::ChatInfo>)), Qt::QueuedConnection);
 		connect(Timer_, SIGNAL(timeout()), this, SLOT(cleanup()), Qt::QueuedConnection);
+
+		connect(Ui::get_gui_settings(), SIGNAL(received()), this, SLOT(guiSettingsReceived()), Qt::QueuedConnection);
+		connect(Ui::get_gui_settings(), SIGNAL(changed(QString)), this, SLOT(guiSettingsChanged(QString)), Qt::QueuedConnection);
 	}
 
 	AvatarStorage::~AvatarStorage()
 	{
+		ScalePool_.clear();
+		ScalePool_.waitForDone();
 	}
 
-	const QPixmapSCptr& AvatarStorage::Get(const QString& _aimId, const QString& _displayName, const int _sizePx, const bool _isFilled, bool& _isDefault, bool _regenerate)
+	QPixmapSCptr AvatarStorage::Get(const QString& _aimId, const QString& _displayName, const int _sizePx, const bool _isFilled, bool& _isDefault, bool _regenerate)
 	{
 		assert(_sizePx > 0);
 
@@ -47,14 +76,14 @@ namespace Logic
 		Out _isDefault = !LoadedAvatars_.contains(_aimId);
 		const auto key = CreateKey(_aimId, _sizePx);
 
-		auto iterByAimIdAndSize = AvatarsByAimIdAndSize_.find(key);
-		if (iterByAimIdAndSize != AvatarsByAimIdAndSize_.end())
+		auto scaledAvatar = Cache_.Find(AvatarCache::Kind::Scaled, key);
+		if (scaledAvatar)
 		{
-			return iterByAimIdAndSize->second;
+			return scaledAvatar;
 		}
 
-		auto iterByAimId = AvatarsByAimId_.find(_aimId);
-		if (iterByAimId == AvatarsByAimId_.end())
+		auto avatarByAimId = Cache_.Find(AvatarCache::Kind::Source, _aimId);
+		if (!avatarByAimId)
 		{
 			auto drawDisplayName = _displayName.trimmed();
 			if (drawDisplayName.isEmpty())
@@ -65,39 +94,44 @@ namespace Logic
 			auto defaultAvatar = Utils::getDefaultAvatar(_aimId, drawDisplayName, _sizePx, _aimId == "mail" ? false : _isFilled);
 			assert(defaultAvatar);
 
-			const auto result = AvatarsByAimId_.emplace(_aimId, std::make_shared<QPixmap>(std::move(defaultAvatar)));
-			assert(result.second);
-
-			iterByAimId = result.first;
+			avatarByAimId = std::make_shared<QPixmap>(std::move(defaultAvatar));
+			Cache_.Insert(AvatarCache::Kind::Source, _aimId, avatarByAimId);
 		}
 
-		const auto &avatarByAimId = *iterByAimId->second;
-        assert(!avatarByAimId.isNull());
+        assert(!avatarByAimId->isNull());
 
-		const auto regenerateAvatar = ((avatarByAimId.width() < _sizePx) && _isDefault) && _aimId != _displayName;
+		const auto regenerateAvatar = ((avatarByAimId->width() < _sizePx) && _isDefault) && _aimId != _displayName;
 		if (regenerateAvatar || _regenerate)
 		{
-			AvatarsByAimId_.erase(iterByAimId);
+			Cache_.Remove(AvatarCache::Kind::Source, _aimId);
 			CleanupSecondaryCaches(_aimId);
 			return Get(_aimId, _displayName, _sizePx, _isFilled, _isDefault, _regenerate);
 		}
 
-        int avatarWidth = avatarByAimId.width();
-        int avatarHeight = avatarByAimId.height();
-        QPixmap scaledImage;
-        if (avatarHeight >= avatarWidth)
-            scaledImage = avatarByAimId.scaledToWidth(_sizePx, Qt::SmoothTransformation);
-        else
-            scaledImage = avatarByAimId.scaledToHeight(_sizePx, Qt::SmoothTransformation);
+		const auto isScaleNeeded = (std::min(avatarByAimId->width(), avatarByAimId->height()) != _sizePx);
+		if (!isScaleNeeded)
+		{
+			scaledAvatar = avatarByAimId;
+			Cache_.Insert(AvatarCache::Kind::Scaled, key, scaledAvatar);
+		}
+		else
+		{
+			// a cheap placeholder is shown until the smooth copy comes from the scale pool
+			scaledAvatar = std::make_shared<QPixmap>(ScaleFast(*avatarByAimId, _sizePx));
+			Cache_.Insert(AvatarCache::Kind::Scaled, key, scaledAvatar);
+		}
 
-		const auto result = AvatarsByAimIdAndSize_.emplace(key, std::make_shared<QPixmap>(std::move(scaledImage)));
-		assert(result.second);
+		if (isScaleNeeded && !IsPending(AvatarCache::Kind::Scaled, key))
+		{
+			const auto ticket = AddPendingTask(AvatarCache::Kind::Scaled, key, _aimId);
+			StartScaleTask(new AvatarScaleTask(ticket, avatarByAimId->toImage(), _sizePx));
+		}
 
         if (_aimId == "mail")
-            return result.first->second;
+            return scaledAvatar;
 
 		auto requestedAvatarsIter = RequestedAvatars_.find(_aimId);
-		if (requestedAvatarsIter == RequestedAvatars_.end() || (avatarByAimId.width() < _sizePx && avatarByAimId.height() < _sizePx))
+		if (requestedAvatarsIter == RequestedAvatars_.end() || (avatarByAimId->width() < _sizePx && avatarByAimId->height() < _sizePx))
 		{
 			Ui::gui_coll_helper collection(Ui::GetDispatcher()->create_collection(), true);
 			collection.set_value_as_qstring("contact", _aimId);
@@ -116,26 +150,25 @@ namespace Logic
             Ui::GetDispatcher()->post_message_to_core("avatars/show", collection.get());
         }
 
-		return result.first->second;
+		return scaledAvatar;
 	}
 
     void AvatarStorage::SetAvatar(const QString& _aimId, const QPixmap& _pixmap)
     {
         assert(!_aimId.isEmpty());
 
-        auto iter = AvatarsByAimId_.find(_aimId);
-        if (iter == AvatarsByAimId_.end())
+        const auto source = Cache_.Find(AvatarCache::Kind::Source, _aimId);
+        if (!source)
             return;
 
-        const auto size = iter->second->height();
+        const auto size = source->height();
         auto scaled = _pixmap.scaled(size, size, Qt::KeepAspectRatio, Qt::SmoothTransformation);
 
-        AvatarsByAimId_[_aimId] = std::make_shared<QPixmap>(scaled);
+        Cache_.Insert(AvatarCache::Kind::Source, _aimId, std::make_shared<QPixmap>(scaled));
 
         CleanupSecondaryCaches(_aimId);
 
-        LoadedAvatars_.removeAll(_aimId);
-        LoadedAvatars_ << _aimId;
+        LoadedAvatars_.insert(_aimId);
 
         emit avatarChanged(_aimId);
     }
@@ -147,21 +180,18 @@ namespace Logic
 
         if (TimesCache_.find(_aimId) != TimesCache_.end())
         {
-            auto iter = AvatarsByAimId_.find(_aimId);
-            if (iter != AvatarsByAimId_.end())
+            const auto source = Cache_.Find(AvatarCache::Kind::Source, _aimId);
+            if (source)
             {
                 Ui::gui_coll_helper collection(Ui::GetDispatcher()->create_collection(), true);
                 collection.set_value_as_qstring("contact", _aimId);
-                collection.set_value_as_int("size", iter->second->height());
+                collection.set_value_as_int("size", source->height());
                 collection.set_value_as_bool("force", true);
                 Ui::GetDispatcher()->post_message_to_core("avatars/get", collection.get());
             }
 
-            AvatarsByAimId_.erase(_aimId);
-            CleanupSecondaryCaches(_aimId);
-            RequestedAvatars_.erase(_aimId);
-            LoadedAvatars_.removeAll(_aimId);
-            TimesCache_.erase(_aimId);
+            Cache_.Remove(AvatarCache::Kind::Source, _aimId);
+            ForgetAvatar(_aimId);
         }
     }
     
@@ -174,18 +204,18 @@ namespace Logic
         Ui::GetDispatcher()->post_message_to_core("avatars/get", collection.get());
     }
     
-	const QPixmapSCptr& AvatarStorage::GetRounded(const QString& _aimId, const QString& _displayName, const int _sizePx, const QString& _state, const bool _isFilled, bool& _isDefault, bool _regenerate, bool mini_icons)
+	QPixmapSCptr AvatarStorage::GetRounded(const QString& _aimId, const QString& _displayName, const int _sizePx, const QString& _state, const bool _isFilled, bool& _isDefault, bool _regenerate, bool mini_icons)
 	{
 		assert(_sizePx > 0);
 
-		const auto &avatar = Get(_aimId, _displayName, _sizePx, _isFilled, _isDefault, _regenerate);
+		const auto avatar = Get(_aimId, _displayName, _sizePx, _isFilled, _isDefault, _regenerate);
         if (avatar->isNull())
         {
             assert(!"avatar is null");
             return avatar;
         }
 
-		return GetRounded(*avatar, _aimId, _state, mini_icons, _isDefault);
+		return GetRounded(*avatar, _aimId, _sizePx, _state, mini_icons, _isDefault);
 	}
 
 	QString AvatarStorage::GetLocal(const QString& _aimId, const QString& _displayName, const int _sizePx, const bool _isFilled)
@@ -241,20 +271,11 @@ namespace Logic
 
         QPixmapSCptr avatar(_pixmap);
         auto scaledImage = avatar->scaled(_size, _size, Qt::KeepAspectRatio, Qt::SmoothTransformation);
-        QPixmapSCptr cache = std::make_shared<QPixmap>(std::move(scaledImage));
-		auto iterPixmap = AvatarsByAimId_.find(_aimId);
-		if (iterPixmap != AvatarsByAimId_.end())
-		{
-			iterPixmap->second = cache;
-		}
-		else
-		{
-			AvatarsByAimId_.emplace(_aimId, cache);
-		}
+        Cache_.Insert(AvatarCache::Kind::Source, _aimId, std::make_shared<QPixmap>(std::move(scaledImage)));
 
 		CleanupSecondaryCaches(_aimId);
 
-		LoadedAvatars_ << _aimId;
+		LoadedAvatars_.insert(_aimId);
 
 		emit avatarChanged(_aimId);
 	}
@@ -289,8 +310,7 @@ namespace Logic
         if (LoadedAvatars_.contains(_aimId))
             return;
 
-        if (AvatarsByAimId_.find(_aimId) != AvatarsByAimId_.end())
-            AvatarsByAimId_.erase(_aimId);
+        Cache_.Remove(AvatarCache::Kind::Source, _aimId);
         CleanupSecondaryCaches(_aimId);
         emit avatarChanged(_aimId);
     }
@@ -311,10 +331,10 @@ namespace Logic
                     continue;
                 }
 
-				AvatarsByAimId_.erase(aimId);
+				Cache_.Remove(AvatarCache::Kind::Source, aimId);
 				CleanupSecondaryCaches(aimId);
 				RequestedAvatars_.erase(aimId);
-				LoadedAvatars_.removeAll(aimId);
+				LoadedAvatars_.remove(aimId);
 				iter = TimesCache_.erase(iter);
 			}
 			else
@@ -322,46 +342,118 @@ namespace Logic
 				++iter;
 			}
 		}
+
+		const auto &stats = Cache_.GetStats();
+		__TRACE(
+			"avatars",
+			"avatar cache stats\n" <<
+			__LOGP(hits, stats.Hits_) <<
+			__LOGP(misses, stats.Misses_) <<
+			__LOGP(evictions, stats.Evictions_) <<
+			__LOGP(entries, stats.Entries_) <<
+			__LOGP(bytes, stats.Bytes_) <<
+			__LOGP(budget, stats.Budget_) <<
+			__LOGP(pending, PendingTasks_.size()));
 	}
 
-    // TODO : use two-step hash here
-	void AvatarStorage::CleanupSecondaryCaches(const QString& _aimId)
+	void AvatarStorage::avatarScaled(quint64 _ticket, QImage _result)
 	{
-		const auto cleanupSecondaryCache = [&_aimId](CacheMap &cache)
+		const auto iter = PendingTasks_.find(_ticket);
+		if (iter == PendingTasks_.end())
 		{
-			for (auto i = cache.begin(); i != cache.end(); ++i)
+			// the avatar was changed or evicted while the task was running
+			return;
+		}
+
+		const auto task = iter->second;
+
+		PendingTasks_.erase(iter);
+		PendingTicketsByKey_.erase(CreatePendingKey(task.Kind_, task.Key_));
+
+		if (_result.isNull() || !Cache_.Contains(AvatarCache::Kind::Source, task.AimId_))
+		{
+			return;
+		}
+
+		Cache_.Insert(task.Kind_, task.Key_, std::make_shared<QPixmap>(QPixmap::fromImage(_result)));
+
+		emit avatarChanged(task.AimId_);
+	}
+
+	void AvatarStorage::guiSettingsReceived()
+	{
+		Cache_.SetBudget(GetCacheBudgetFromSettings());
+	}
+
+	void AvatarStorage::guiSettingsChanged(QString _key)
+	{
+		if (_key == settings_avatars_cache_budget_mb)
+		{
+			Cache_.SetBudget(GetCacheBudgetFromSettings());
+		}
+	}
+
+	const AvatarCacheStats& AvatarStorage::GetCacheStats() const
+	{
+		return Cache_.GetStats();
+	}
+
+	bool AvatarStorage::IsPending(const AvatarCache::Kind _kind, const QString& _key) const
+	{
+		return (PendingTicketsByKey_.find(CreatePendingKey(_kind, _key)) != PendingTicketsByKey_.end());
+	}
+
+	quint64 AvatarStorage::AddPendingTask(const AvatarCache::Kind _kind, const QString& _key, const QString& _aimId)
+	{
+		const auto ticket = ++NextTicket_;
+
+		PendingTasks_.emplace(ticket, PendingTask(_kind, _key, _aimId));
+		PendingTicketsByKey_[CreatePendingKey(_kind, _key)] = ticket;
+
+		return ticket;
+	}
+
+	void AvatarStorage::StartScaleTask(AvatarScaleTask* _task)
+	{
+		assert(_task);
+
+		connect(_task, &AvatarScaleTask::scaledSignal, this, &AvatarStorage::avatarScaled, Qt::QueuedConnection);
+
+		ScalePool_.start(_task);
+	}
+
+	void AvatarStorage::CancelPendingTasks(const QString& _prefix)
+	{
+		for (auto iter = PendingTasks_.begin(); iter != PendingTasks_.end();)
+		{
+			const auto &task = iter->second;
+			if (!task.Key_.startsWith(_prefix))
 			{
-				const auto &key = i->first;
-				if (!key.startsWith(_aimId))
-				{
-					continue;
-				}
-
-				for(;;)
-				{
-					i = cache.erase(i);
-
-					if (i == cache.end())
-					{
-						break;
-					}
-
-					const auto &key = i->first;
-					if (!key.startsWith(_aimId))
-					{
-						break;
-					}
-				}
-
-				break;
+				++iter;
+				continue;
 			}
-		};
 
-		cleanupSecondaryCache(RoundedAvatarsByAimIdAndSize_);
-		cleanupSecondaryCache(AvatarsByAimIdAndSize_);
+			PendingTicketsByKey_.erase(CreatePendingKey(task.Kind_, task.Key_));
+			iter = PendingTasks_.erase(iter);
+		}
 	}
 
-	const QPixmapSCptr& AvatarStorage::GetRounded(const QPixmap& _avatar, const QString& _aimId, const QString& _state, bool mini_icons, bool _isDefault)
+	void AvatarStorage::ForgetAvatar(const QString& _aimId)
+	{
+		CleanupSecondaryCaches(_aimId);
+		RequestedAvatars_.erase(_aimId);
+		LoadedAvatars_.remove(_aimId);
+		TimesCache_.erase(_aimId);
+	}
+
+	void AvatarStorage::CleanupSecondaryCaches(const QString& _aimId)
+	{
+		Cache_.RemoveDerived(_aimId);
+
+		CancelPendingTasks(_aimId + '/');
+	}
+
+	QPixmapSCptr AvatarStorage::GetRounded(const QPixmap& _avatar, const QString& _aimId, const int _sizePx, const QString& _state, bool mini_icons, bool _isDefault)
 	{
 		assert(!_avatar.isNull());
 
@@ -373,18 +465,32 @@ namespace Logic
 		key += "/";
 		key += _state;
 
-		auto i = RoundedAvatarsByAimIdAndSize_.find(key);
-		if (i == RoundedAvatarsByAimIdAndSize_.end())
+		auto rounded = Cache_.Find(AvatarCache::Kind::Rounded, key);
+		if (rounded)
 		{
-			const auto roundedAvatar = Utils::roundImage(_avatar, _state, _isDefault, mini_icons);
-			i = RoundedAvatarsByAimIdAndSize_
-				.emplace(
-					key,
-					std::make_shared<QPixmap>(std::move(roundedAvatar)))
-				.first;
+			return rounded;
 		}
 
-		return i->second;
+		const auto source = Cache_.Find(AvatarCache::Kind::Source, _aimId);
+		if (!source)
+		{
+			rounded = std::make_shared<QPixmap>(Utils::roundImage(_avatar, _state, _isDefault, mini_icons));
+			Cache_.Insert(AvatarCache::Kind::Rounded, key, rounded);
+
+			return rounded;
+		}
+
+		// the jagged placeholder is swapped for the antialiased one with status icons when the task finishes
+		rounded = std::make_shared<QPixmap>(RoundFast(_avatar));
+		Cache_.Insert(AvatarCache::Kind::Rounded, key, rounded);
+
+		if (!IsPending(AvatarCache::Kind::Rounded, key))
+		{
+			const auto ticket = AddPendingTask(AvatarCache::Kind::Rounded, key, _aimId);
+			StartScaleTask(new AvatarScaleTask(ticket, source->toImage(), _sizePx, _state, _isDefault, mini_icons));
+		}
+
+		return rounded;
 	}
 
 	AvatarStorage* GetAvatarStorage()
@@ -409,4 +515,45 @@ namespace
 
 		return result;
 	}
+
+	QString CreatePendingKey(const Logic::AvatarCache::Kind _kind, const QString& _key)
+	{
+		return (QString::number((int)_kind) + ':' + _key);
+	}
+
+	QPixmap ScaleFast(const QPixmap& _avatar, const int _sizePx)
+	{
+		assert(!_avatar.isNull());
+		assert(_sizePx > 0);
+
+		if (_avatar.height() >= _avatar.width())
+		{
+			return _avatar.scaledToWidth(_sizePx, Qt::FastTransformation);
+		}
+
+		return _avatar.scaledToHeight(_sizePx, Qt::FastTransformation);
+	}
+
+	QPixmap RoundFast(const QPixmap& _avatar)
+	{
+		assert(!_avatar.isNull());
+
+		const auto scale = std::min(_avatar.height(), _avatar.width());
+
+		QPixmap result(scale, scale);
+		result.fill(Qt::transparent);
+
+		QPainter painter(&result);
+		painter.setClipRegion(QRegion(0, 0, scale, scale, QRegion::Ellipse));
+		painter.drawPixmap(0, 0, _avatar);
+
+		return result;
+	}
+
+	int64_t GetCacheBudgetFromSettings()
+	{
+		const auto budgetMb = Ui::get_gui_settings()->get_value<int>(settings_avatars_cache_budget_mb, DEFAULT_CACHE_BUDGET_MB);
+
+		return ((int64_t)std::max(budgetMb, 1) * 1024 * 1024);
+	}
 }
@@ -3,9 +3,11 @@
 #include "../../types/contact.h"
 #include "../../types/chat.h"
 
+#include "AvatarCache.h"
+
 namespace Logic
 {
-	typedef std::shared_ptr<const QPixmap> QPixmapSCptr;
+	class AvatarScaleTask;
 
 	class AvatarStorage : public QObject
 	{
@@ -23,15 +25,21 @@ namespace Logic
 
 		void cleanup();
 
+		void avatarScaled(quint64 _ticket, QImage _result);
+
+		void guiSettingsReceived();
+
+		void guiSettingsChanged(QString _key);
+
     public Q_SLOTS:
         void UpdateAvatar(const QString& _aimId, bool force = true);
         
 	public:
 		~AvatarStorage();
 
-		const QPixmapSCptr& Get(const QString& _aimId, const QString& _displayName, const int _sizePx, const bool _isFilled, bool& _isDefault, bool _regenerate);
+		QPixmapSCptr Get(const QString& _aimId, const QString& _displayName, const int _sizePx, const bool _isFilled, bool& _isDefault, bool _regenerate);
 
-		const QPixmapSCptr& GetRounded(const QString& _aimId, const QString& _displayName, const int _sizePx, const QString& _state, const bool _isFilled, bool& _isDefault, bool _regenerate, bool mini_icons);
+		QPixmapSCptr GetRounded(const QString& _aimId, const QString& _displayName, const int _sizePx, const QString& _state, const bool _isFilled, bool& _isDefault, bool _regenerate, bool mini_icons);
 
 		QString GetLocal(const QString& _aimId, const QString& _displayName, const int _sizePx, const bool _isFilled);
 
@@ -40,24 +48,49 @@ namespace Logic
 
         void SetAvatar(const QString& _aimId, const QPixmap& _pixmap);
 
+		const AvatarCacheStats& GetCacheStats() const;
+
     private:
-		typedef std::map<QString, QPixmapSCptr> CacheMap;
+		struct PendingTask
+		{
+			PendingTask(const AvatarCache::Kind _kind, const QString& _key, const QString& _aimId);
+
+			const AvatarCache::Kind Kind_;
+
+			const QString Key_;
+
+			const QString AimId_;
+		};
 
 		AvatarStorage();
 
 		void CleanupSecondaryCaches(const QString& _aimId);
 
-		const QPixmapSCptr& GetRounded(const QPixmap& _avatar, const QString& _aimId, const QString& _state, bool mini_icons, bool _isDefault);
+		void CancelPendingTasks(const QString& _prefix);
+
+		void ForgetAvatar(const QString& _aimId);
+
+		QPixmapSCptr GetRounded(const QPixmap& _avatar, const QString& _aimId, const int _sizePx, const QString& _state, bool mini_icons, bool _isDefault);
+
+		bool IsPending(const AvatarCache::Kind _kind, const QString& _key) const;
+
+		quint64 AddPendingTask(const AvatarCache::Kind _kind, const QString& _key, const QString& _aimId);
+
+		void StartScaleTask(AvatarScaleTask* _task);
+
+		AvatarCache Cache_;
+
+		QThreadPool ScalePool_;
 
-		CacheMap AvatarsByAimIdAndSize_;
+		std::map<quint64, PendingTask> PendingTasks_;
 
-		CacheMap AvatarsByAimId_;
+		std::map<QString, quint64> PendingTicketsByKey_;
 
-		CacheMap RoundedAvatarsByAimIdAndSize_;
+		quint64 NextTicket_;
 
 		std::set<QString> RequestedAvatars_;
 
-		QStringList LoadedAvatars_;
+		QSet<QString> LoadedAvatars_;
 
         QStringList LoadedAvatarsFails_;
 
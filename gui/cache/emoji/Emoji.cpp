@@ -19,6 +19,24 @@ namespace
 		const QString ResourceName_;
 	};
 
+	struct EmojiAtlas
+	{
+		EmojiAtlas(QImage _image, const int32_t _cellSizePx, const qreal _pixelRatio);
+
+		bool IsValid() const;
+
+		QRect GetCellRect(const int32_t _index) const;
+
+		// premultiplied argb32 texture, every emoji of the set packed in a grid of square cells
+		const QImage Image_;
+
+		const int32_t CellSizePx_;
+
+		const int32_t Columns_;
+
+		const qreal PixelRatio_;
+	};
+
 	static const std::array<EmojiSizePx, 8> AvailableSizes_ =
 	{
 		EmojiSizePx::_16,
@@ -31,14 +49,19 @@ namespace
 		EmojiSizePx::_64
 	};
 
+	const auto AtlasColumns_ = 32;
+
+	const auto AtlasVersion_ = 2;
+
 	QFuture<bool> Loading_;
 
-	typedef std::unordered_map<int32_t, const QImage> EmojiSetsMap;
+	typedef std::unordered_map<int32_t, const EmojiAtlas> EmojiSetsMap;
 
 	typedef EmojiSetsMap::iterator EmojiSetsIter;
 
 	EmojiSetsMap EmojiSetBySize_;
 
+	// views into the atlas pixels, no per-emoji pixel data is stored here
 	std::unordered_map<int64_t, const QImage> EmojiCache_;
 
 	int32_t GetEmojiSizeForCurrentUiScale();
@@ -49,6 +72,16 @@ namespace
 
 	EmojiSetsIter LoadEmojiSetForSizeIfNeeded(const EmojiSetMeta& _meta);
 
+	QImage LoadEmojiSetFromResources(const EmojiSetMeta& _meta);
+
+	QImage RenderEmojiSet(const int32_t _sizePx, const qreal _pixelRatio);
+
+	QString GetAtlasCachePath(const int32_t _sizePx, const qreal _pixelRatio);
+
+	qreal GetAtlasPixelRatio();
+
+	QImage MakeEmojiView(const EmojiAtlas& _atlas, const int32_t _index);
+
 	int64_t MakeCacheKey(const int32_t _index, const int32_t _sizePx);
 
 }
@@ -74,6 +107,7 @@ namespace Emoji
 
 	void Cleanup()
 	{
+		// views must go first, they reference the atlas pixels
 		EmojiCache_.clear();
 		EmojiSetBySize_.clear();
 	}
@@ -109,60 +143,21 @@ namespace Emoji
 			return cacheIter->second;
 		}
 
-        QImage image;
-
-        if (platform::is_apple())
-        {
-            auto pixelRatio = qApp->primaryScreen()->devicePixelRatio();
-            
-            QFont font(QStringLiteral("AppleColorEmoji"), sizeToSearch - Utils::scale_value(6));
-            QFontMetrics metrics(font);
-            QString s = Utils::SChar(_main, _ext).ToQString();
-            
-            QImage imageOut(QSize(sizeToSearch * pixelRatio, sizeToSearch * pixelRatio), QImage::Format_ARGB32);
-            imageOut.fill(Qt::transparent);
-            imageOut.setDevicePixelRatio(pixelRatio);
-            
-            QPainter painter(&imageOut);
-            painter.setFont(font);
-            painter.drawText(QRect(0, 0, sizeToSearch, sizeToSearch), Qt::AlignCenter, s);
-            painter.end();
-            
-            image = imageOut;
-
-            /*
-            auto pixelRatio = qApp->primaryScreen()->devicePixelRatio();
-            
-            QImage imageOut(QSize(sizeToSearch * pixelRatio, sizeToSearch * pixelRatio), QImage::Format_ARGB32);
-            imageOut.fill(Qt::transparent);
-            imageOut.setDevicePixelRatio(pixelRatio);
-            
-            QPainter painter(&imageOut);
-            painter.setFont(QFont(QStringLiteral("AppleColorEmoji"), sizeToSearch));
-            painter.drawText(QRect(0, -2, sizeToSearch, sizeToSearch + 2), Qt::AlignHCenter, Utils::SChar(_main, _ext).ToQString());
-            painter.end();
-            
-            image = imageOut;
-            */
-        }
-        else
-        {
-            const auto &meta = GetMetaBySize(sizeToSearch);
-
-            const auto emojiSetIter = LoadEmojiSetForSizeIfNeeded(meta);
-
-            const auto isSetMissing = (emojiSetIter == EmojiSetBySize_.end());
-            if (isSetMissing)
-            {
-                return empty;
-            }
-
-            QRect r(0, 0, meta.SizePx_, meta.SizePx_);
-            const auto offsetX = (info->Index_ * meta.SizePx_);
-            r.translate(offsetX, 0);
-
-            image = emojiSetIter->second.copy(r);
-        }
+		const auto &meta = GetMetaBySize(sizeToSearch);
+
+		const auto emojiSetIter = LoadEmojiSetForSizeIfNeeded(meta);
+
+		const auto isSetMissing = (emojiSetIter == EmojiSetBySize_.end());
+		if (isSetMissing)
+		{
+			return empty;
+		}
+
+		auto image = MakeEmojiView(emojiSetIter->second, info->Index_);
+		if (image.isNull())
+		{
+			return empty;
+		}
 
         const auto result = EmojiCache_.emplace(key, std::move(image));
         assert(result.second);
@@ -273,6 +268,32 @@ namespace
 		return *info[_sizePx];
 	}
 
+	EmojiAtlas::EmojiAtlas(QImage _image, const int32_t _cellSizePx, const qreal _pixelRatio)
+		: Image_(_image.convertToFormat(QImage::Format_ARGB32_Premultiplied))
+		, CellSizePx_(_cellSizePx)
+		, Columns_((_cellSizePx > 0) ? (_image.width() / _cellSizePx) : 0)
+		, PixelRatio_(_pixelRatio)
+	{
+		assert(CellSizePx_ > 0);
+		assert(PixelRatio_ > 0);
+	}
+
+	bool EmojiAtlas::IsValid() const
+	{
+		return (!Image_.isNull() && (Columns_ > 0));
+	}
+
+	QRect EmojiAtlas::GetCellRect(const int32_t _index) const
+	{
+		assert(_index >= 0);
+		assert(Columns_ > 0);
+
+		const auto column = (_index % Columns_);
+		const auto row = (_index / Columns_);
+
+		return QRect(column * CellSizePx_, row * CellSizePx_, CellSizePx_, CellSizePx_);
+	}
+
 	EmojiSetsIter LoadEmojiSetForSizeIfNeeded(const EmojiSetMeta& _meta)
 	{
 		assert(_meta.SizePx_ > 0);
@@ -283,14 +304,139 @@ namespace
 			return emojiSetIter;
 		}
 
+		const auto pixelRatio = GetAtlasPixelRatio();
+		const auto cellSizePx = (int32_t)(_meta.SizePx_ * pixelRatio);
+
 		QImage setImg;
-		const auto success = setImg.load(_meta.ResourceName_);
-		if (!success)
+
+		if (platform::is_apple())
+		{
+			const auto cachePath = GetAtlasCachePath(_meta.SizePx_, pixelRatio);
+
+			if (!setImg.load(cachePath))
+			{
+				setImg = RenderEmojiSet(_meta.SizePx_, pixelRatio);
+
+				QDir().mkpath(QFileInfo(cachePath).absolutePath());
+				setImg.save(cachePath, "PNG");
+			}
+		}
+		else
+		{
+			setImg = LoadEmojiSetFromResources(_meta);
+		}
+
+		if (setImg.isNull())
+		{
+			return EmojiSetBySize_.end();
+		}
+
+		EmojiAtlas atlas(std::move(setImg), cellSizePx, pixelRatio);
+		if (!atlas.IsValid())
 		{
 			return EmojiSetBySize_.end();
 		}
 
-		return EmojiSetBySize_.emplace(_meta.SizePx_, std::move(setImg)).first;
+		return EmojiSetBySize_.emplace(_meta.SizePx_, std::move(atlas)).first;
+	}
+
+	QImage LoadEmojiSetFromResources(const EmojiSetMeta& _meta)
+	{
+		// bundled sets are prebuilt single-row atlases indexed by EmojiRecord::Index_
+		QImage setImg;
+		if (!setImg.load(_meta.ResourceName_))
+		{
+			return QImage();
+		}
+
+		return setImg;
+	}
+
+	QImage RenderEmojiSet(const int32_t _sizePx, const qreal _pixelRatio)
+	{
+		assert(_sizePx > 0);
+
+		const auto cellSizePx = (int32_t)(_sizePx * _pixelRatio);
+
+		// the cells are addressed by the record indexes, these are sparse and go past the records count
+		auto maxIndex = -1;
+		for (const auto &category : GetEmojiCategories())
+		{
+			for (const auto &record : GetEmojiInfoByCategory(category))
+			{
+				maxIndex = std::max(maxIndex, record->Index_);
+			}
+		}
+
+		const auto rows = std::max((maxIndex + AtlasColumns_) / AtlasColumns_, 1);
+
+		QImage atlas(QSize(AtlasColumns_ * cellSizePx, rows * cellSizePx), QImage::Format_ARGB32_Premultiplied);
+		atlas.fill(Qt::transparent);
+		atlas.setDevicePixelRatio(_pixelRatio);
+
+		QPainter painter(&atlas);
+		painter.setFont(QFont(QStringLiteral("AppleColorEmoji"), _sizePx - Utils::scale_value(6)));
+
+		for (const auto &category : GetEmojiCategories())
+		{
+			for (const auto &record : GetEmojiInfoByCategory(category))
+			{
+				const auto column = (record->Index_ % AtlasColumns_);
+				const auto row = (record->Index_ / AtlasColumns_);
+
+				const QRect cell(column * _sizePx, row * _sizePx, _sizePx, _sizePx);
+
+				painter.drawText(cell, Qt::AlignCenter, Utils::SChar(record->Codepoint_, record->ExtendedCodepoint_).ToQString());
+			}
+		}
+
+		painter.end();
+
+		return atlas;
+	}
+
+	QString GetAtlasCachePath(const int32_t _sizePx, const qreal _pixelRatio)
+	{
+		assert(_sizePx > 0);
+
+		const auto cacheDir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+
+		return QString("%1/emoji/atlas_%2_%3x_v%4_%5.png")
+			.arg(cacheDir)
+			.arg(_sizePx)
+			.arg(_pixelRatio)
+			.arg(AtlasVersion_)
+			.arg(GetEmojiDbSize());
+	}
+
+	qreal GetAtlasPixelRatio()
+	{
+		if (!platform::is_apple())
+		{
+			return 1;
+		}
+
+		return qApp->primaryScreen()->devicePixelRatio();
+	}
+
+	QImage MakeEmojiView(const EmojiAtlas& _atlas, const int32_t _index)
+	{
+		assert(_atlas.IsValid());
+		assert(_atlas.Image_.depth() == 32);
+
+		const auto rect = _atlas.GetCellRect(_index);
+		if (!_atlas.Image_.rect().contains(rect))
+		{
+			assert(!"emoji index is out of the atlas bounds");
+			return QImage();
+		}
+
+		const auto bits = (_atlas.Image_.constBits() + (rect.top() * _atlas.Image_.bytesPerLine()) + (rect.left() * 4));
+
+		QImage view(bits, rect.width(), rect.height(), _atlas.Image_.bytesPerLine(), _atlas.Image_.format());
+		view.setDevicePixelRatio(_atlas.PixelRatio_);
+
+		return view;
 	}
 
 	int64_t MakeCacheKey(const int32_t _index, const int32_t _sizePx)
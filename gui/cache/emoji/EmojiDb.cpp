@@ -6,11 +6,18 @@ namespace
 {
 	using namespace Emoji;
 
-	std::vector<EmojiRecordSptr> EmojiIndexByOrder_;
+	constexpr EmojiRecord EmojiIndex_[] =
+	{
+		#include "EmojiIndexData.cpp"
+	};
+
+	constexpr auto EmojiIndexSize_ = (sizeof(EmojiIndex_) / sizeof(EmojiIndex_[0]));
 
-	std::unordered_map<uint64_t, EmojiRecordSptr> EmojiIndexByCodepoint_;
+	typedef std::pair<uint64_t, EmojiRecordPtr> CodepointIndexEntry;
 
-	std::map<QString, EmojiRecordSptrVec> EmojiIndexByCategory_;
+	std::vector<CodepointIndexEntry> EmojiIndexByCodepoint_;
+
+	std::map<QString, EmojiRecordPtrVec> EmojiIndexByCategory_;
 
 	QStringList EmojiCategories_;
 
@@ -18,61 +25,109 @@ namespace
 	{
 		return ((uint64_t)codepoint) | ((uint64_t)extendedCodepoint << 32);
 	}
-}
 
-namespace Emoji
-{
-	EmojiRecord::EmojiRecord(const QString& _category, const int _index, const unsigned _codepoint, const unsigned _extendedCodepoint, const QString& _name)
-		: Category_(_category)
-		, Index_(_index)
-		, Name_(_name)
-		, Codepoint_(_codepoint)
-		, ExtendedCodepoint_(_extendedCodepoint)
+	bool IsExcludedOnCurrentPlatform(const EmojiRecord& _record)
 	{
-		assert(!Category_.isEmpty());
-		assert(!Name_.isEmpty());
-		assert(Index_ >= 0);
-		assert(Codepoint_ > 0);
+#if defined(__APPLE__)
+		switch (_record.Exclusion_)
+		{
+			case MacExclusion::_10_9:
+				return (QSysInfo().macVersion() <= QSysInfo::MV_10_9);
+
+			case MacExclusion::_10_10:
+				return (QSysInfo().macVersion() <= QSysInfo::MV_10_10);
+
+			case MacExclusion::_10_11:
+				return (QSysInfo().macVersion() <= QSysInfo::MV_10_11);
+
+			default:
+				return false;
+		}
+#else
+		(void)_record;
+		return false;
+#endif
 	}
+}
 
+namespace Emoji
+{
 	void InitEmojiDb()
 	{
-		#include "EmojiIndexData.cpp"
-		assert(!EmojiIndexByOrder_.empty());
+		static_assert(EmojiIndexSize_ > 0, "emoji index is empty");
+
+		EmojiIndexByCodepoint_.reserve(EmojiIndexSize_);
 
-		for (const auto &record : EmojiIndexByOrder_)
+		for (const auto &record : EmojiIndex_)
 		{
-			const auto &category = record->Category_;
-			assert(!category.isEmpty());
+			assert(record.Category_ && *record.Category_);
+			assert(record.Name_ && *record.Name_);
+			assert(record.Index_ >= 0);
+			assert(record.Codepoint_ > 0);
+
+			if (IsExcludedOnCurrentPlatform(record))
+			{
+				continue;
+			}
+
+			const auto category = QString::fromLatin1(record.Category_);
 
 			if (!EmojiCategories_.contains(category))
 			{
 				EmojiCategories_.append(category);
 			}
 
-			const auto extendedCodepoint = MakeComplexCodepoint(record->Codepoint_, record->ExtendedCodepoint_);
-			EmojiIndexByCodepoint_.emplace(extendedCodepoint, record);
+			const auto extendedCodepoint = MakeComplexCodepoint(record.Codepoint_, record.ExtendedCodepoint_);
+			EmojiIndexByCodepoint_.emplace_back(extendedCodepoint, &record);
 
 			auto iter = EmojiIndexByCategory_.find(category);
 			if (iter == EmojiIndexByCategory_.end())
 			{
-				EmojiRecordSptrVec v;
-				v.reserve(EmojiIndexByCodepoint_.size());
+				EmojiRecordPtrVec v;
+				v.reserve(EmojiIndexSize_);
 				iter = EmojiIndexByCategory_.emplace(category, std::move(v)).first;
 			}
 
-			iter->second.push_back(record);
+			iter->second.push_back(&record);
 		}
+
+		for (auto &category : EmojiIndexByCategory_)
+		{
+			category.second.shrink_to_fit();
+		}
+
+		std::sort(
+			EmojiIndexByCodepoint_.begin(),
+			EmojiIndexByCodepoint_.end(),
+			[](const CodepointIndexEntry& _lhs, const CodepointIndexEntry& _rhs)
+			{
+				return (_lhs.first < _rhs.first);
+			}
+		);
+	}
+
+	int32_t GetEmojiDbSize()
+	{
+		return (int32_t)EmojiIndexSize_;
 	}
 
-	const EmojiRecordSptr& GetEmojiInfoByCodepoint(const uint32_t _codepoint, const uint32_t _extendedCodepoint)
+	EmojiRecordPtr GetEmojiInfoByCodepoint(const uint32_t _codepoint, const uint32_t _extendedCodepoint)
 	{
 		assert(_codepoint > 0);
 		assert(!EmojiIndexByCodepoint_.empty());
 
 		const auto complexCodepoint = MakeComplexCodepoint(_codepoint, _extendedCodepoint);
-		const auto iter = EmojiIndexByCodepoint_.find(complexCodepoint);
-		if (iter == EmojiIndexByCodepoint_.end())
+		const auto iter = std::lower_bound(
+			EmojiIndexByCodepoint_.cbegin(),
+			EmojiIndexByCodepoint_.cend(),
+			complexCodepoint,
+			[](const CodepointIndexEntry& _entry, const uint64_t _value)
+			{
+				return (_entry.first < _value);
+			}
+		);
+
+		if ((iter == EmojiIndexByCodepoint_.cend()) || (iter->first != complexCodepoint))
 		{
 			return EmptyEmoji;
 		}
@@ -86,11 +141,11 @@ namespace Emoji
 		return EmojiCategories_;
 	}
 
-	const EmojiRecordSptrVec& GetEmojiInfoByCategory(const QString& _category)
+	const EmojiRecordPtrVec& GetEmojiInfoByCategory(const QString& _category)
 	{
 		assert(!_category.isEmpty());
 
-		static const EmojiRecordSptrVec empty;
+		static const EmojiRecordPtrVec empty;
 
 		const auto iter = EmojiIndexByCategory_.find(_category);
 		if (iter == EmojiIndexByCategory_.end())
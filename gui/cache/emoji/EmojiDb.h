@@ -2,32 +2,42 @@
 
 namespace Emoji
 {
+	enum class MacExclusion
+	{
+		None,
+
+		_10_9,
+		_10_10,
+		_10_11
+	};
+
 	struct EmojiRecord
 	{
-		EmojiRecord(const QString& _category, const int _index, const unsigned _codepoint, const unsigned _extendedCodepoint, const QString& _name);
+		const char* Category_;
 
-		const QString Category_;
+		int Index_;
 
-		const int Index_;
+		unsigned Codepoint_;
 
-		const QString Name_;
+		unsigned ExtendedCodepoint_;
 
-		const unsigned Codepoint_;
+		const char* Name_;
 
-		const unsigned ExtendedCodepoint_;		
+		MacExclusion Exclusion_;
 	};
 
-	typedef std::shared_ptr<EmojiRecord> EmojiRecordSptr;
+	typedef const EmojiRecord* EmojiRecordPtr;
 
-	typedef std::vector<EmojiRecordSptr> EmojiRecordSptrVec;
+	typedef std::vector<EmojiRecordPtr> EmojiRecordPtrVec;
 
 	void InitEmojiDb();
 
-    
-    static const EmojiRecordSptr EmptyEmoji;
-	const EmojiRecordSptr& GetEmojiInfoByCodepoint(const uint32_t _codepoint, const uint32_t _extendedCodepoint);
+	int32_t GetEmojiDbSize();
+
+	static const EmojiRecordPtr EmptyEmoji = nullptr;
+	EmojiRecordPtr GetEmojiInfoByCodepoint(const uint32_t _codepoint, const uint32_t _extendedCodepoint);
 
 	const QStringList& GetEmojiCategories();
 
-	const EmojiRecordSptrVec& GetEmojiInfoByCategory(const QString& _category);
-}
\ No newline at end of file
+	const EmojiRecordPtrVec& GetEmojiInfoByCategory(const QString& _category);
+}
@@ -0,0 +1,313 @@
+#include "stdafx.h"
+
+#include "../../utils/ImageDecodePool.h"
+
+#include "PreviewDiskCache.h"
+#include "PreviewCache.h"
+
+namespace
+{
+    const int64_t MemoryBudget_ = (32 * 1024 * 1024);
+
+    const int64_t DiskBudget_ = (256 * 1024 * 1024);
+
+    const quint32 FileMagic_ = 0x49505643;
+
+    const quint32 FileVersion_ = 1;
+
+    const int32_t JpegQuality_ = 85;
+
+    QString MakeKey(const QString& _uri, const QSize& _size)
+    {
+        assert(!_uri.isEmpty());
+        assert(_size.isValid());
+
+        return QString("%1|%2x%3@%4")
+            .arg(_uri)
+            .arg(_size.width())
+            .arg(_size.height())
+            .arg(qApp->devicePixelRatio());
+    }
+
+    bool ReadEntryFile(const QString& _path, Out Logic::PreviewCacheEntry& _entry, Out QImage& _preview)
+    {
+        QFile file(_path);
+        if (!file.open(QIODevice::ReadOnly))
+        {
+            return false;
+        }
+
+        QDataStream stream(&file);
+
+        quint32 magic = 0;
+        quint32 version = 0;
+        stream >> magic >> version;
+
+        if ((magic != FileMagic_) || (version != FileVersion_))
+        {
+            return false;
+        }
+
+        qint64 fileSize = -1;
+        QByteArray encoded;
+        stream >> _entry.DownloadUri_ >> fileSize >> _entry.LocalPath_ >> encoded;
+
+        if ((stream.status() != QDataStream::Ok) || encoded.isEmpty())
+        {
+            return false;
+        }
+
+        _entry.FileSize_ = fileSize;
+
+        return _preview.loadFromData(encoded);
+    }
+
+    void WriteEntryFile(const QString& _path, const Logic::PreviewCacheEntry& _entry, const QImage& _preview)
+    {
+        QByteArray encoded;
+
+        {
+            QBuffer buffer(&encoded);
+            buffer.open(QIODevice::WriteOnly);
+
+            const auto isEncoded = (
+                _preview.hasAlphaChannel() ?
+                    _preview.save(&buffer, "PNG") :
+                    _preview.save(&buffer, "JPG", JpegQuality_));
+
+            if (!isEncoded)
+            {
+                return;
+            }
+        }
+
+        if (!QDir().mkpath(Logic::GetPreviewCacheDir()))
+        {
+            return;
+        }
+
+        // the file gets its name once it is complete
+        const auto tmpPath = QString("%1.%2.tmp").arg(_path).arg((quintptr)QThread::currentThreadId());
+
+        {
+            QFile file(tmpPath);
+            if (!file.open(QIODevice::WriteOnly))
+            {
+                return;
+            }
+
+            QDataStream stream(&file);
+            stream << FileMagic_ << FileVersion_;
+            stream << _entry.DownloadUri_ << (qint64)_entry.FileSize_ << _entry.LocalPath_ << encoded;
+        }
+
+        QFile::remove(_path);
+
+        if (!QFile::rename(tmpPath, _path))
+        {
+            QFile::remove(tmpPath);
+        }
+    }
+
+    // the files written long ago go first once the cache dir outgrows its budget
+    void PruneCacheDir()
+    {
+        QDir dir(Logic::GetPreviewCacheDir());
+
+        const auto files = dir.entryInfoList(QDir::Files, QDir::Time);
+
+        int64_t bytes = 0;
+
+        for (const auto &file : files)
+        {
+            bytes += file.size();
+
+            if (bytes > DiskBudget_)
+            {
+                QFile::remove(file.absoluteFilePath());
+            }
+        }
+    }
+
+    int64_t GetPixmapBytes(const QPixmap& _pixmap)
+    {
+        return ((int64_t)_pixmap.width() * _pixmap.height() * std::max(_pixmap.depth(), 8) / 8);
+    }
+}
+
+namespace Logic
+{
+    PreviewCacheEntry::PreviewCacheEntry()
+        : FileSize_(-1)
+    {
+    }
+
+    PreviewCache::Entry::Entry(const QString& _key, const PreviewCacheEntry& _entry)
+        : Key_(_key)
+        , Entry_(_entry)
+        , Bytes_(GetPixmapBytes(_entry.Preview_))
+    {
+    }
+
+    PreviewCache::PreviewCache()
+        : Bytes_(0)
+        , IsDiskPruned_(false)
+    {
+    }
+
+    bool PreviewCache::Find(const QString& _uri, const QSize& _size, Out PreviewCacheEntry& _entry)
+    {
+        auto iter = Index_.find(MakeKey(_uri, _size));
+        if (iter == Index_.end())
+        {
+            return false;
+        }
+
+        Lru_.splice(Lru_.begin(), Lru_, iter.value());
+
+        _entry = iter.value()->Entry_;
+
+        return true;
+    }
+
+    bool PreviewCache::Load(const QString& _uri, const QSize& _size, QObject* _owner, const PreviewLoadedCallback& _loaded)
+    {
+        assert(_loaded);
+
+        const auto key = MakeKey(_uri, _size);
+
+        const auto path = GetPreviewCacheFilePath(key);
+        if (!QFile::exists(path))
+        {
+            return false;
+        }
+
+        Read(key, path, Utils::DecodePriority::NearViewport, _owner, _loaded);
+
+        return true;
+    }
+
+    void PreviewCache::Put(const QString& _uri, const QSize& _size, const PreviewCacheEntry& _entry)
+    {
+        assert(!_entry.Preview_.isNull());
+
+        const auto key = MakeKey(_uri, _size);
+
+        Remember(key, _entry);
+
+        const auto path = GetPreviewCacheFilePath(key);
+        const auto preview = _entry.Preview_.toImage();
+        const auto prune = !IsDiskPruned_;
+
+        IsDiskPruned_ = true;
+
+        auto metainfo = _entry;
+        metainfo.Preview_ = QPixmap();
+
+        QtConcurrent::run(QThreadPool::globalInstance(), [path, metainfo, preview, prune]
+        {
+            WriteEntryFile(path, metainfo, preview);
+
+            if (prune)
+            {
+                PruneCacheDir();
+            }
+        });
+    }
+
+    void PreviewCache::Warm(const QString& _uri, const QSize& _size)
+    {
+        const auto key = MakeKey(_uri, _size);
+        if (Index_.contains(key))
+        {
+            return;
+        }
+
+        const auto path = GetPreviewCacheFilePath(key);
+        if (!QFile::exists(path))
+        {
+            return;
+        }
+
+        Read(key, path, Utils::DecodePriority::Prefetch, nullptr, [](const PreviewCacheEntry&){});
+    }
+
+    void PreviewCache::Read(const QString& _key, const QString& _path, const Utils::DecodePriority _priority, QObject* _owner, const PreviewLoadedCallback& _loaded)
+    {
+        // the metainfo is filled in by the decoder before the consumer is called,
+        // so the decode is not shared with another load of the same preview
+        auto entry = std::make_shared<PreviewCacheEntry>();
+
+        const auto decoder = [_path, entry]
+        {
+            QImage preview;
+            if (!ReadEntryFile(_path, Out *entry, Out preview))
+            {
+                QFile::remove(_path);
+                return QPixmap();
+            }
+
+            if (!entry->LocalPath_.isEmpty() && !QFile::exists(entry->LocalPath_))
+            {
+                entry->LocalPath_.clear();
+            }
+
+            return QPixmap::fromImage(preview);
+        };
+
+        Utils::GetImageDecodePool()->decode(
+            QString(),
+            _priority,
+            _owner,
+            decoder,
+            [this, _key, entry, _loaded](QPixmap preview)
+            {
+                entry->Preview_ = preview;
+
+                if (!preview.isNull())
+                {
+                    Remember(_key, *entry);
+                }
+
+                _loaded(*entry);
+            });
+    }
+
+    void PreviewCache::Remember(const QString& _key, const PreviewCacheEntry& _entry)
+    {
+        auto iter = Index_.find(_key);
+        if (iter != Index_.end())
+        {
+            Bytes_ -= iter.value()->Bytes_;
+
+            Lru_.erase(iter.value());
+            Index_.erase(iter);
+        }
+
+        Lru_.emplace_front(_key, _entry);
+        Index_.insert(_key, Lru_.begin());
+
+        Bytes_ += Lru_.front().Bytes_;
+
+        Shrink();
+    }
+
+    void PreviewCache::Shrink()
+    {
+        while ((Bytes_ > MemoryBudget_) && (Lru_.size() > 1))
+        {
+            const auto &victim = Lru_.back();
+
+            Bytes_ -= victim.Bytes_;
+
+            Index_.remove(victim.Key_);
+            Lru_.pop_back();
+        }
+    }
+
+    PreviewCache* GetPreviewCache()
+    {
+        static std::unique_ptr<PreviewCache> cache(new PreviewCache());
+        return cache.get();
+    }
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+namespace Utils
+{
+    enum class DecodePriority;
+}
+
+namespace Logic
+{
+    struct PreviewCacheEntry
+    {
+        PreviewCacheEntry();
+
+        QPixmap Preview_;
+
+        QString DownloadUri_;
+
+        int64_t FileSize_;
+
+        QString LocalPath_;
+    };
+
+    typedef std::function<void(const PreviewCacheEntry& _entry)> PreviewLoadedCallback;
+
+    // the previews of the chat media found by the uri, the size they were decoded at and the pixel ratio of the screen;
+    // the previews used lately are kept in memory, all of them are kept on disk with the metainfo of their images
+    // so that a chat opened again shows its media without asking the core
+    class PreviewCache
+    {
+    public:
+        PreviewCache();
+
+        bool Find(const QString& _uri, const QSize& _size, Out PreviewCacheEntry& _entry);
+
+        // the preview is read from disk in the decode pool, the callback gets a null preview if it turned out broken;
+        // false if there is no preview on disk
+        bool Load(const QString& _uri, const QSize& _size, QObject* _owner, const PreviewLoadedCallback& _loaded);
+
+        void Put(const QString& _uri, const QSize& _size, const PreviewCacheEntry& _entry);
+
+        // the preview is read from disk ahead of the block showing it, unless it is in memory already
+        void Warm(const QString& _uri, const QSize& _size);
+
+    private:
+        struct Entry
+        {
+            Entry(const QString& _key, const PreviewCacheEntry& _entry);
+
+            const QString Key_;
+
+            PreviewCacheEntry Entry_;
+
+            int64_t Bytes_;
+        };
+
+        typedef std::list<Entry> EntryList;
+
+        void Read(const QString& _key, const QString& _path, const Utils::DecodePriority _priority, QObject* _owner, const PreviewLoadedCallback& _loaded);
+
+        void Remember(const QString& _key, const PreviewCacheEntry& _entry);
+
+        void Shrink();
+
+        EntryList Lru_;
+
+        QHash<QString, EntryList::iterator> Index_;
+
+        int64_t Bytes_;
+
+        bool IsDiskPruned_;
+    };
+
+    PreviewCache* GetPreviewCache();
+}
@@ -0,0 +1,99 @@
+#include "stdafx.h"
+
+#include <QtCore/QCryptographicHash>
+
+#include "PreviewDiskCache.h"
+
+namespace
+{
+    const int32_t JpegQuality_ = 90;
+
+    QString GetCachedPreviewPath(const QString& _imagePath, const QSize& _maxSize)
+    {
+        assert(!_imagePath.isEmpty());
+        assert(_maxSize.isValid());
+
+        const QFileInfo imageInfo(_imagePath);
+        if (!imageInfo.exists())
+        {
+            return QString();
+        }
+
+        const auto key = QString("%1|%2|%3|%4x%5")
+            .arg(imageInfo.absoluteFilePath())
+            .arg(imageInfo.size())
+            .arg(imageInfo.lastModified().toMSecsSinceEpoch())
+            .arg(_maxSize.width())
+            .arg(_maxSize.height());
+
+        return Logic::GetPreviewCacheFilePath(key);
+    }
+}
+
+namespace Logic
+{
+    QString GetPreviewCacheDir()
+    {
+        return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/previews";
+    }
+
+    QString GetPreviewCacheFilePath(const QString& _key)
+    {
+        assert(!_key.isEmpty());
+
+        const auto hash = QCryptographicHash::hash(_key.toUtf8(), QCryptographicHash::Sha1).toHex();
+
+        return (GetPreviewCacheDir() + "/" + QString::fromLatin1(hash));
+    }
+
+    bool LoadCachedPreview(const QString& _imagePath, const QSize& _maxSize, Out QImage& _preview)
+    {
+        const auto previewPath = GetCachedPreviewPath(_imagePath, _maxSize);
+        if (previewPath.isEmpty() || !QFile::exists(previewPath))
+        {
+            return false;
+        }
+
+        // the previews are kept without an extension, the format is told by the content
+        QImageReader reader(previewPath);
+        reader.setDecideFormatFromContent(true);
+
+        return reader.read(&_preview);
+    }
+
+    void SaveCachedPreview(const QString& _imagePath, const QSize& _maxSize, const QImage& _preview)
+    {
+        assert(!_preview.isNull());
+
+        // only a preview scaled down is worth keeping, a small image is decoded as fast as its preview
+        const auto isScaledDown = ((_preview.width() == _maxSize.width()) || (_preview.height() == _maxSize.height()));
+        if (!isScaledDown)
+        {
+            return;
+        }
+
+        const auto previewPath = GetCachedPreviewPath(_imagePath, _maxSize);
+        if (previewPath.isEmpty() || QFile::exists(previewPath))
+        {
+            return;
+        }
+
+        if (!QDir().mkpath(GetPreviewCacheDir()))
+        {
+            return;
+        }
+
+        // the same preview may be written by several tasks at once, only a complete file gets the final name
+        const auto tmpPath = QString("%1.%2.tmp").arg(previewPath).arg((quintptr)QThread::currentThreadId());
+
+        const auto isSaved = (
+            _preview.hasAlphaChannel() ?
+                _preview.save(tmpPath, "PNG") :
+                _preview.save(tmpPath, "JPG", JpegQuality_));
+
+        if (!isSaved || !QFile::rename(tmpPath, previewPath))
+        {
+            QFile::remove(tmpPath);
+        }
+    }
+}
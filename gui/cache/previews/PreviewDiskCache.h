@@ -0,0 +1,15 @@
+#pragma once
+
+namespace Logic
+{
+    QString GetPreviewCacheDir();
+
+    // the file of a preview kept under the key
+    QString GetPreviewCacheFilePath(const QString& _key);
+
+    // the previews of the large images are scaled once and kept in the cache dir;
+    // a preview is found by the path, the size and the modification time of its image and by the size it was scaled to
+    bool LoadCachedPreview(const QString& _imagePath, const QSize& _maxSize, Out QImage& _preview);
+
+    void SaveCachedPreview(const QString& _imagePath, const QSize& _maxSize, const QImage& _preview);
+}
@@ -11,12 +11,13 @@
 #include "types/typing.h"
 #include "utils/gui_coll_helper.h"
 #include "utils/InterConnector.h"
-#include "utils/LoadPixmapFromDataTask.h"
+#include "utils/ImageDecodePool.h"
 #include "utils/uid.h"
 #include "utils/utils.h"
 #include "cache/stickers/stickers.h"
 #include "cache/themes/themes.h"
 #include "utils/log/log.h"
+#include "utils/profiling/timeline.h"
 #include "../common.shared/common_defs.h"
 #include "../corelib/corelib.h"
 #include "../corelib/core_face.h"
@@ -188,7 +189,9 @@ int64_t core_dispatcher::downloadImage(
     const bool _isPreview,
     const int32_t _previewWidth,
     const int32_t _previewHeight,
-    bool _raisePriority)
+    bool _raisePriority,
+    const QSize& _decodeMaxSize,
+    QObject* _decodeOwner)
 {
     assert(!_contactAimid.isEmpty());
     assert(_uri.isValid());
@@ -212,6 +215,14 @@ int64_t core_dispatcher::downloadImage(
 
     const auto seq = post_message_to_core("image/download", collection.get());
 
+    if (_decodeMaxSize.isValid() || _decodeOwner)
+    {
+        auto &decode = imageDecodes_[seq];
+        decode.max_size_ = _decodeMaxSize;
+        decode.owner_ = _decodeOwner;
+        decode.has_owner_ = !!_decodeOwner;
+    }
+
     __INFO(
         "snippets",
         "GUI(1): requested image\n"
@@ -478,6 +489,7 @@ void core_dispatcher::initMessageMap()
     REGISTER_IM_MESSAGE("themes/meta/get/result", onThemesMetaGetResult);
     REGISTER_IM_MESSAGE("themes/meta/get/error", onThemesMetaGetError);
     REGISTER_IM_MESSAGE("stickers/sticker/get/result", onStickersStickerGetResult);
+    REGISTER_IM_MESSAGE("stickers/download/progress", onStickersDownloadProgress);
     REGISTER_IM_MESSAGE("themes/theme/get/result", onThemesThemeGetResult);
     REGISTER_IM_MESSAGE("chats/info/get/result", onChatsInfoGetResult);
     REGISTER_IM_MESSAGE("chats/blocked/result", onChatsBlockedResult);
@@ -534,6 +546,8 @@ void core_dispatcher::initMessageMap()
     REGISTER_IM_MESSAGE("masks/progress", onMasksProgress);
     REGISTER_IM_MESSAGE("masks/update/retry", onMasksRetryUpdate);
 
+    REGISTER_IM_MESSAGE("archive/holes/progress", onHolesProgress);
+
     REGISTER_IM_MESSAGE("mailboxes/status", onMailStatus);
     REGISTER_IM_MESSAGE("mailboxes/new", onMailNew);
 
@@ -696,6 +710,15 @@ void core_dispatcher::imageDownloadResult(const int64_t _seq, core::coll_helper
     const auto data = _params.get_value_as_stream("data");
     const auto local = _params.get<QString>("local");
 
+    image_decode_info decode;
+
+    const auto iterDecode = imageDecodes_.find(_seq);
+    if (iterDecode != imageDecodes_.end())
+    {
+        decode = iterDecode->second;
+        imageDecodes_.erase(iterDecode);
+    }
+
     __INFO(
         "snippets",
         "completed image downloading\n"
@@ -713,11 +736,22 @@ void core_dispatcher::imageDownloadResult(const int64_t _seq, core::coll_helper
     assert(!local.isEmpty());
     assert(!rawUri.isEmpty());
 
-    auto task = new Utils::LoadPixmapFromDataTask(data);
+    if (decode.has_owner_ && !decode.owner_)
+    {
+        // nobody is left to show the image
+        return;
+    }
+
+    // the images asked for without a widget are the ones the user is waiting for
+    const auto priority = (decode.has_owner_ ? Utils::DecodePriority::NearViewport : Utils::DecodePriority::Visible);
 
-    const auto succeeded = QObject::connect(
-        task, &Utils::LoadPixmapFromDataTask::loadedSignal,
-        this,
+    const auto key = QString("%1|%2x%3").arg(local).arg(decode.max_size_.width()).arg(decode.max_size_.height());
+
+    Utils::GetImageDecodePool()->decode(
+        key,
+        priority,
+        decode.owner_,
+        Utils::makeDataDecoder(data, decode.max_size_, local),
         [this, _seq, rawUri, local]
         (QPixmap pixmap)
         {
@@ -728,11 +762,7 @@ void core_dispatcher::imageDownloadResult(const int64_t _seq, core::coll_helper
             }
 
             emit imageDownloaded(_seq, rawUri, pixmap, local);
-        },
-        Qt::QueuedConnection);
-    assert(succeeded);
-
-    QThreadPool::globalInstance()->start(task);
+        });
 }
 
 void core_dispatcher::imageDownloadResultMeta(const int64_t _seq, core::coll_helper _params)
@@ -812,20 +842,16 @@ void core_dispatcher::linkMetainfoDownloadResultImage(const int64_t _seq, core::
 
     const auto data = _params.get_value_as_stream("data");
 
-    auto task = new Utils::LoadPixmapFromDataTask(data);
-
-    const auto succeeded = QObject::connect(
-        task, &Utils::LoadPixmapFromDataTask::loadedSignal,
-        this,
+    Utils::GetImageDecodePool()->decode(
+        QString(),
+        Utils::DecodePriority::NearViewport,
+        nullptr,
+        Utils::makeDataDecoder(data),
         [this, _seq, success]
         (QPixmap pixmap)
         {
             emit linkMetainfoImageDownloaded(_seq, success, pixmap);
-        },
-        Qt::QueuedConnection);
-    assert(succeeded);
-
-    QThreadPool::globalInstance()->start(task);
+        });
 }
 
 void core_dispatcher::linkMetainfoDownloadResultFavicon(const int64_t _seq, core::coll_helper _params)
@@ -842,20 +868,16 @@ void core_dispatcher::linkMetainfoDownloadResultFavicon(const int64_t _seq, core
 
     const auto data = _params.get_value_as_stream("data");
 
-    auto task = new Utils::LoadPixmapFromDataTask(data);
-
-    const auto succeeded = QObject::connect(
-        task, &Utils::LoadPixmapFromDataTask::loadedSignal,
-        this,
+    Utils::GetImageDecodePool()->decode(
+        QString(),
+        Utils::DecodePriority::NearViewport,
+        nullptr,
+        Utils::makeDataDecoder(data),
         [this, _seq, success]
         (QPixmap pixmap)
         {
             emit linkMetainfoFaviconDownloaded(_seq, success, pixmap);
-        },
-        Qt::QueuedConnection);
-    assert(succeeded);
-
-    QThreadPool::globalInstance()->start(task);
+        });
 }
 
 void core_dispatcher::onFilesSpeechToTextResult(const int64_t _seq, core::coll_helper _params)
@@ -910,6 +932,11 @@ void core_dispatcher::onMasksRetryUpdate(const int64_t _seq, core::coll_helper _
     emit maskRetryUpdate();
 }
 
+void core_dispatcher::onHolesProgress(const int64_t _seq, core::coll_helper _params)
+{
+    emit holesProgress(_params.get_value_as_uint("pending"), _params.get_value_as_uint("running"), _params.get_value_as_uint("finished"));
+}
+
 void core_dispatcher::onMailStatus(const int64_t _seq, core::coll_helper _params)
 {
     auto array = _params.get_value_as_array("mailboxes");
@@ -1237,6 +1264,8 @@ void core_dispatcher::onContactList(const int64_t _seq, core::coll_helper _param
 
     Data::UnserializeContactList(&_params, *cl, type);
 
+    Profiling::markPhase("gui.contact_list");
+
     emit contactList(cl, type);
 }
 
@@ -1386,6 +1415,8 @@ void core_dispatcher::onMessagesDelUpTo(const int64_t _seq, core::coll_helper _p
 
 void core_dispatcher::onDlgStates(const int64_t _seq, core::coll_helper _params)
 {
+    Profiling::markPhase("gui.dlg_states");
+
     const auto myAimid = _params.get<QString>("my_aimid");
 
     auto dlgStatesList = std::make_shared<QList<Data::DlgState>>();
@@ -1554,6 +1585,13 @@ void core_dispatcher::onStickersStickerGetResult(const int64_t _seq, core::coll_
         _params.get_value_as_int("sticker_id"));
 }
 
+void core_dispatcher::onStickersDownloadProgress(const int64_t _seq, core::coll_helper _params)
+{
+    emit onStickersProgress(
+        _params.get_value_as_int("loaded"),
+        _params.get_value_as_int("total"));
+}
+
 void core_dispatcher::onThemesThemeGetResult(const int64_t _seq, core::coll_helper _params)
 {
     bool failed = _params.get_value_as_int("failed", 0) != 0;
@@ -150,6 +150,7 @@ Q_SIGNALS:
         // sticker signals
         void onStickers();
         void onSticker(qint32 _setId, qint32 _stickerId);
+        void onStickersProgress(qint32 _loaded, qint32 _total);
 
         void onThemesMeta();
         void onThemesMetaError();
@@ -213,6 +214,9 @@ Q_SIGNALS:
         void mrimKey(qint64, QString);
 
         void historyUpdate(QString, qint64);
+
+        // the history holes downloading, the chains waiting, running and finished since the start
+        void holesProgress(unsigned _pending, unsigned _running, unsigned _finished);
         void userSnaps(Logic::UserSnapsInfo, bool);
         void userSnapsState(Logic::SnapState);
         void userSnapsStorage(QList<Logic::UserSnapsInfo>, bool);
@@ -254,7 +258,9 @@ Q_SIGNALS:
             const bool _isPreview,
             const int32_t _maxPreviewWidth,
             const int32_t _maxPreviewHeight,
-            bool _raisePriority = false);
+            bool _raisePriority = false,
+            const QSize& _decodeMaxSize = QSize(),
+            QObject* _decodeOwner = nullptr);
 
         void cancelImageDownloading(const QString& _url);
 
@@ -324,6 +330,7 @@ Q_SIGNALS:
         void onThemesMetaGetResult(const int64_t _seq, core::coll_helper _params);
         void onThemesMetaGetError(const int64_t _seq, core::coll_helper _params);
         void onStickersStickerGetResult(const int64_t _seq, core::coll_helper _params);
+        void onStickersDownloadProgress(const int64_t _seq, core::coll_helper _params);
         void onThemesThemeGetResult(const int64_t _seq, core::coll_helper _params);
         void onChatsInfoGetResult(const int64_t _seq, core::coll_helper _params);
         void onChatsBlockedResult(const int64_t _seq, core::coll_helper _params);
@@ -377,6 +384,7 @@ Q_SIGNALS:
         void onMasksGetResult(const int64_t _seq, core::coll_helper _params);
         void onMasksProgress(const int64_t _seq, core::coll_helper _params);
         void onMasksRetryUpdate(const int64_t _seq, core::coll_helper _params);
+        void onHolesProgress(const int64_t _seq, core::coll_helper _params);
         void onMailStatus(const int64_t _seq, core::coll_helper _params);
         void onMailNew(const int64_t _seq, core::coll_helper _params);
         void getMrimKeyResult(const int64_t _seq, core::coll_helper _params);
@@ -403,6 +411,21 @@ Q_SIGNALS:
             }
         };
 
+        struct image_decode_info
+        {
+            QSize max_size_;
+
+            // the widget showing the image, the decode is dropped with it
+            QPointer<QObject> owner_;
+
+            bool has_owner_;
+
+            image_decode_info()
+                :   has_owner_(false)
+            {
+            }
+        };
+
     private:
 
         bool init();
@@ -425,6 +448,9 @@ Q_SIGNALS:
 
         std::unordered_map<int64_t, callback_info> callbacks_;
 
+        // the downloaded images to be decoded at the size of their previews or for a widget
+        std::unordered_map<int64_t, image_decode_info> imageDecodes_;
+
         QDateTime lastTimeCallbacksCleanedUp_;
 
         bool isStatsEnabled_;
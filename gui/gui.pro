@@ -29,6 +29,10 @@ SOURCES += \
     stdafx.cpp \
     cache/countries.cpp \
     cache/avatars/AvatarStorage.cpp \
+    cache/avatars/AvatarCache.cpp \
+    cache/previews/PreviewDiskCache.cpp \
+    cache/previews/PreviewCache.cpp \
+    cache/avatars/AvatarScaleTask.cpp \
     cache/emoji/Emoji.cpp \
     cache/emoji/EmojiDb.cpp \
     cache/emoji/EmojiIndexData.cpp \
@@ -60,6 +64,7 @@ SOURCES += \
     main_window/contact_list/ContactList.cpp \
     main_window/contact_list/ContactListItemDelegate.cpp \
     main_window/contact_list/ContactListItemRenderer.cpp \
+    main_window/contact_list/ItemRasterCache.cpp \
     main_window/contact_list/ContactListModel.cpp \
     main_window/contact_list/contact_profile.cpp \
     main_window/contact_list/RecentItemDelegate.cpp \
@@ -135,14 +140,15 @@ SOURCES += \
     ../gui.shared/translator_base.cpp \
     utils/log/log.cpp \
     utils/profiling/auto_stop_watch.cpp \
+    utils/profiling/timeline.cpp \
     controls/BackgroundWidget.cpp \
     ../common.shared/common_defs.cpp \
     main_window/history_control/MessageItemLayout.cpp \
     main_window/history_control/MessagesScrollArea.cpp \
     main_window/history_control/MessagesScrollAreaLayout.cpp \
     main_window/history_control/MessagesScrollbar.cpp \
-    main_window/history_control/ResizePixmapTask.cpp \
     main_window/sounds/MpegLoader.cpp \
+    main_window/sounds/DecodedSoundCache.cpp \
     utils/Text.cpp \
     main_window/history_control/MessageStatusWidget.cpp \
     main_window/history_control/MessageStyle.cpp \
@@ -164,8 +170,7 @@ SOURCES += \
     types/typing.cpp \
     controls/GeneralCreator.cpp \
     main_window/GroupChatOperations.cpp \
-    utils/LoadPixmapFromDataTask.cpp \
-    utils/LoadPixmapFromFile.cpp \
+    utils/ImageDecodePool.cpp \
     main_window/history_control/ContentWidgets/FileSharingWidget.cpp \
     main_window/history_control/ContentWidgets/ImagePreviewWidget.cpp \
     main_window/history_control/ContentWidgets/MessageContentWidget.cpp \
@@ -229,6 +234,7 @@ SOURCES += \
     controls/TransparentScrollBar.cpp \
     utils/exif.cpp \
     main_window/mplayer/FFMpegPlayer.cpp \
+    main_window/mplayer/AnimationCache.cpp \
     main_window/mplayer/MultimediaViewer.cpp \
     main_window/mplayer/VideoPlayer.cpp \
     controls/ToolTipEx.cpp \
@@ -256,6 +262,10 @@ HEADERS  += \
     stdafx.h \
     cache/countries.h \
     cache/avatars/AvatarStorage.h \
+    cache/avatars/AvatarCache.h \
+    cache/previews/PreviewDiskCache.h \
+    cache/previews/PreviewCache.h \
+    cache/avatars/AvatarScaleTask.h \
     cache/emoji/Emoji.h \
     cache/emoji/EmojiDb.h \
     cache/stickers/stickers.h \
@@ -287,6 +297,7 @@ HEADERS  += \
     main_window/contact_list/ContactList.h \
     main_window/contact_list/ContactListItemDelegate.h \
     main_window/contact_list/ContactListItemRenderer.h \
+    main_window/contact_list/ItemRasterCache.h \
     main_window/contact_list/ContactListModel.h \
     main_window/contact_list/contact_profile.h \
     main_window/contact_list/RecentItemDelegate.h \
@@ -370,6 +381,7 @@ HEADERS  += \
     ../gui.shared/translator_base.h \
     utils/log/log.h \
     utils/profiling/auto_stop_watch.h \
+    utils/profiling/timeline.h \
     cp_afxres.h \
     controls/BackgroundWidget.h \
     ../common.shared/common_defs.h \
@@ -377,10 +389,9 @@ HEADERS  += \
     main_window/history_control/MessagesScrollArea.h \
     main_window/history_control/MessagesScrollAreaLayout.h \
     main_window/history_control/MessagesScrollbar.h \
-    main_window/history_control/ResizePixmapTask.h \
     main_window/sounds/MpegLoader.h \
+    main_window/sounds/DecodedSoundCache.h \
     utils/Text.h \
-    LoadPixmapFromDataTask.h \
     resource.h \
     main_window/history_control/MessageStatusWidget.h \
     main_window/history_control/MessageStyle.h \
@@ -399,8 +410,7 @@ HEADERS  += \
     types/typing.h \
     controls/GeneralCreator.h \
     main_window/GroupChatOperations.h \
-    utils/LoadPixmapFromDataTask.h \
-    utils/LoadPixmapFromFileTask.h \
+    utils/ImageDecodePool.h \
     main_window/history_control/ContentWidgets/FileSharingWidget.h \
     main_window/history_control/ContentWidgets/ImagePreviewWidget.h \
     main_window/history_control/ContentWidgets/MessageContentWidget.h \
@@ -466,6 +476,7 @@ HEADERS  += \
     utils/exif.h \
     main_window/mplayer/ffmpeg.h \
     main_window/mplayer/FFMpegPlayer.h \
+    main_window/mplayer/AnimationCache.h \
     main_window/mplayer/MultimediaViewer.h \
     main_window/mplayer/VideoPlayer.h \
     controls/ToolTipEx.h \
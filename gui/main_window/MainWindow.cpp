@@ -24,6 +24,7 @@
 #include "../previewer/Previewer.h"
 #include "../utils/utils.h"
 #include "../utils/InterConnector.h"
+#include "../utils/profiling/timeline.h"
 #include "../cache/stickers/stickers.h"
 #include "../cache/snaps/SnapStorage.h"
 #include "../my_info.h"
@@ -1784,6 +1785,8 @@ namespace Ui
 
     void MainWindow::exit()
     {
+        Profiling::markPhase("shutdown.gui_exit");
+
 #ifdef STRIP_VOIP
         QApplication::exit();
 #else
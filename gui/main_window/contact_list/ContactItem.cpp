@@ -8,6 +8,7 @@ namespace Logic
 		: contact_(_contact)
 		, visible_(true)
 	{
+		update_sort_name();
 	}
 
 	bool ContactItem::operator== (const ContactItem& _other) const
@@ -128,4 +129,14 @@ namespace Logic
 	{
 		return contact_->AimId_;
 	}
+
+	const QString& ContactItem::get_sort_name() const
+	{
+		return sort_name_;
+	}
+
+	void ContactItem::update_sort_name()
+	{
+		sort_name_ = contact_->GetDisplayName().toUpper();
+	}
 }
@@ -44,6 +44,10 @@ namespace Logic
 		profile_ptr getContactProfile() const;
 		QString get_aimid() const;
 
+		// the display name in upper case the contacts are ordered by, taken again when the name changes
+		const QString& get_sort_name() const;
+		void update_sort_name();
+
 	private:
 
 		std::shared_ptr<Data::Contact>				contact_;
@@ -53,6 +57,7 @@ namespace Logic
 		bool			visible_;
 		QString			input_text_;
         QString         chat_role_;
+		QString			sort_name_;
 	};
 
 	static_assert(std::is_move_assignable<ContactItem>::value, "ContactItem must be move assignable");
@@ -47,6 +47,9 @@ namespace
     const int BACK_HEIGHT = 12;
     const int RECENTS_HEIGHT = 68;
 
+    // the rows past each edge of the recents painted into the row cache while scrolling
+    const int PRERENDER_ROWS = 4;
+
     QMap<QString, QVariant> makeData(const QString& _command, const QString& _aimid = QString())
     {
         QMap<QString, QVariant> result;
@@ -315,6 +318,11 @@ namespace Ui
         connect(recentsView_->verticalScrollBar(), SIGNAL(valueChanged(int)), this, SLOT(recentsScrolled(int)), Qt::DirectConnection);
         connect(recentsView_->verticalScrollBar(), SIGNAL(actionTriggered(int)), this, SLOT(recentsScrollActionTriggered(int)), Qt::DirectConnection);
 
+        prerenderTimer_ = new QTimer(this);
+        prerenderTimer_->setSingleShot(true);
+        prerenderTimer_->setInterval(0);
+        connect(prerenderTimer_, SIGNAL(timeout()), this, SLOT(prerenderRecents()), Qt::QueuedConnection);
+
         recentsLayout_->addWidget(recentsView_);
         stackedWidget_->addWidget(recentsPage_);
         Testing::setAccessibleName(recentsView_, "RecentView");
@@ -2040,6 +2048,49 @@ namespace Ui
     {
         if (snaps_)
             snaps_->move(0, -value);
+
+        prerenderTimer_->start();
+    }
+
+    void ContactList::prerenderRecents()
+    {
+        // the unknowns are shown in the same view with their own delegate
+        if (recentsView_->itemDelegate() != recentsDelegate_ || !recentsView_->model())
+            return;
+
+        const auto viewport = recentsView_->viewport()->rect();
+
+        const auto first = recentsView_->indexAt(viewport.topLeft());
+        if (!first.isValid())
+            return;
+
+        const auto last = recentsView_->indexAt(viewport.bottomLeft());
+
+        const auto rowCount = recentsView_->model()->rowCount();
+        const auto lastRow = (last.isValid() ? last.row() : rowCount - 1);
+
+        const auto pixelRatio = recentsView_->devicePixelRatio();
+
+        auto prerender = [this, pixelRatio](const int _row)
+        {
+            const auto index = recentsView_->model()->index(_row, 0);
+
+            QStyleOptionViewItem option;
+            option.rect = recentsView_->visualRect(index);
+            option.state = QStyle::State_Enabled;
+
+            if (recentsView_->selectionModel() && recentsView_->selectionModel()->isSelected(index))
+                option.state |= QStyle::State_Selected;
+
+            if (!option.rect.isEmpty())
+                recentsDelegate_->prerender(option, index, pixelRatio);
+        };
+
+        for (auto row = lastRow + 1; row < std::min(lastRow + 1 + PRERENDER_ROWS, rowCount); ++row)
+            prerender(row);
+
+        for (auto row = first.row() - 1; row >= std::max(first.row() - PRERENDER_ROWS, 0); --row)
+            prerender(row);
     }
 
     void ContactList::recentsScrollActionTriggered(int value)
@@ -200,6 +200,7 @@ namespace Ui
 
         void recentsScrolled(int value);
         void recentsScrollActionTriggered(int value);
+        void prerenderRecents();
 
 	public:
 
@@ -283,6 +284,7 @@ namespace Ui
         SettingsTab*									settingsTab_;
 		QStackedWidget*									stackedWidget_;
         QTimer*                                         scrollTimer_;
+        QTimer*                                         prerenderTimer_;
         FocusableListView*                              scrolledView_;
         int                                             scrollMultipler_;
         QPoint                                          lastDragPos_;
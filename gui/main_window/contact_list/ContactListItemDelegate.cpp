@@ -13,6 +13,11 @@
 #include "ChatMembersModel.h"
 #include "ContactList.h"
 
+namespace
+{
+    const int64_t ROW_CACHE_BUDGET = (16 * 1024 * 1024);
+}
+
 namespace Logic
 {
     ContactListItemDelegate::ContactListItemDelegate(QObject* parent, int _regim, ChatMembersModel* chatMembersModel)
@@ -20,6 +25,7 @@ namespace Logic
         , StateBlocked_(false)
         , renderRole_(false)
         , chatMembersModel_(chatMembersModel)
+        , rowCache_(ROW_CACHE_BUDGET)
     {
         viewParams_.regim_ = _regim;
     }
@@ -128,11 +134,26 @@ namespace Logic
 
             const auto &avatar = Logic::GetAvatarStorage()->GetRounded(aimId, displayName, Utils::scale_bitmap(ContactList::GetContactListParams().avatarSize())
                 , isMultichat ? QString() : state, isFilled, isDefault, false /* _regenerate */ , ContactList::GetContactListParams().isCL());
+            const QPixmap lastReadAvatar;
             const ContactList::VisualDataBase visData(aimId, *avatar, state, status, isHovered, isSelected, displayName, hasLastSeen, lastSeen
-                , isChecked, isChatMember, isOfficial, false /* draw last read */, QPixmap() /* last seen avatar*/, role, 0 /* unread count */, "" /* search_term */);
+                , isChecked, isChatMember, isOfficial, false /* draw last read */, lastReadAvatar /* last seen avatar*/, role, 0 /* unread count */, "" /* search_term */);
+
+            const ContactList::ViewParams viewParams(viewParams_.regim_, viewParams_.fixedWidth_, viewParams_.leftMargin_, viewParams_.rightMargin_);
+
+            // the shown time is taken in, as it is relative to now ("now", "3 min", "yesterday")
+            ContactList::ItemStateHash stateHash;
+            stateHash << aimId << *avatar << state << status << isHovered << isSelected << displayName << hasLastSeen << lastSeen
+                << isChecked << isChatMember << isOfficial << role << viewParams.regim_ << viewParams.fixedWidth_
+                << viewParams.leftMargin_ << viewParams.rightMargin_ << ContactList::FormatTime(lastSeen);
+
+            const auto look = (isSelected ? 2 : (isHovered ? 1 : 0));
 
-            ContactList::ViewParams viewParams(viewParams_.regim_, viewParams_.fixedWidth_, viewParams_.leftMargin_, viewParams_.rightMargin_);
-            ContactList::RenderContactItem(*painter, visData, viewParams);
+            const auto &row = rowCache_.Get(aimId + '/' + QString::number(look), stateHash.value(), option.rect.size(), painter->device()->devicePixelRatio(), [&visData, &viewParams](QPainter& _painter)
+            {
+                ContactList::RenderContactItem(_painter, visData, viewParams);
+            });
+
+            painter->drawPixmap(0, 0, row);
         }
 
         if (index == DragIndex_)
@@ -184,21 +205,33 @@ namespace Logic
 
     void ContactListItemDelegate::setFixedWidth(int width)
     {
+        if (viewParams_.fixedWidth_ != width)
+            rowCache_.Clear();
+
         viewParams_.fixedWidth_ = width;
     }
 
     void ContactListItemDelegate::setLeftMargin(int margin)
     {
+        if (viewParams_.leftMargin_ != margin)
+            rowCache_.Clear();
+
         viewParams_.leftMargin_ = margin;
     }
 
     void ContactListItemDelegate::setRightMargin(int margin)
     {
+        if (viewParams_.rightMargin_ != margin)
+            rowCache_.Clear();
+
         viewParams_.rightMargin_ = margin;
     }
 
     void ContactListItemDelegate::setRegim(int _regim)
     {
+        if (viewParams_.regim_ != _regim)
+            rowCache_.Clear();
+
         viewParams_.regim_ = _regim;
     }
 
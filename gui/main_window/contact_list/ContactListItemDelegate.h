@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Common.h"
+#include "ItemRasterCache.h"
 
 namespace Logic
 {
@@ -37,5 +38,7 @@ namespace Logic
         QModelIndex DragIndex_;
         ContactList::ViewParams viewParams_;
         ChatMembersModel* chatMembersModel_;
+
+        mutable ContactList::ItemRasterCache rowCache_;
     };
 }
@@ -31,7 +31,7 @@ namespace
                 if (_second.is_group())
                     return false;
 
-                return _first.Get()->GetDisplayName().toUpper() < _second.Get()->GetDisplayName().toUpper();
+                return _first.get_sort_name() < _second.get_sort_name();
             }
 
             return _first.Get()->GroupId_ < _second.Get()->GroupId_;
@@ -62,7 +62,7 @@ namespace
             if (firstIsActive != secondIsActive)
                 return firstIsActive;
 
-            return _first.Get()->GetDisplayName().toUpper() < _second.Get()->GetDisplayName().toUpper();
+            return _first.get_sort_name() < _second.get_sort_name();
         }
 
         QDateTime current_;
@@ -86,8 +86,8 @@ namespace
             if (firstIsActive != secondIsActive)
                 return firstIsActive;
 
-            const auto& firstName = _first.Get()->GetDisplayName().toUpper();
-            const auto& secondName = _second.Get()->GetDisplayName().toUpper();
+            const auto& firstName = _first.get_sort_name();
+            const auto& secondName = _second.get_sort_name();
 
             if (firstName[0].isLetter() != secondName[0].isLetter())
                 return firstName[0].isLetter();
@@ -104,6 +104,9 @@ namespace
     };
 
     const int REFRESH_TIMER = 5000;
+
+    // the share of the changed contacts past which the whole list is sorted again
+    const int FULL_SORT_RATIO = 8;
 }
 
 namespace Logic
@@ -133,7 +136,7 @@ namespace Logic
 
         timer_->setSingleShot(true);
         timer_->setInterval(REFRESH_TIMER);
-        connect(timer_, &QTimer::timeout, this, &Logic::ContactListModel::refresh, Qt::QueuedConnection);
+        connect(timer_, &QTimer::timeout, this, &Logic::ContactListModel::sortChanged, Qt::QueuedConnection);
     }
 
     int ContactListModel::rowCount(const QModelIndex &) const
@@ -255,6 +258,7 @@ namespace Logic
         if (item != nullptr)
         {
             item->Get()->ApplyBuddy(_contact);
+            item->update_sort_name();
             setContactVisible(_contact->AimId_, true);
             Logic::GetAvatarStorage()->UpdateDefaultAvatarIfNeed(_contact->AimId_);
         }
@@ -262,11 +266,12 @@ namespace Logic
         {
             contacts_.emplace_back(_contact);
             sorted_index_cl_.emplace_back((int)contacts_.size() - 1);
-            sorted_index_recents_.emplace_back((int)contacts_.size() - 1);
             indexes_.insert(_contact->AimId_, (int)contacts_.size() - 1);
             emit dataChanged(index((int)contacts_.size() - 1), index((int)contacts_.size() - 1));
         }
 
+        scheduleSort(_contact->AimId_);
+
         updatePlaceholders();
         return (int)contacts_.size();
     }
@@ -274,16 +279,17 @@ namespace Logic
     void ContactListModel::rebuild_index()
     {
         indexes_.clear();
-        unsigned i = 0;
+        reindex(0, (int)sorted_index_cl_.size());
 
-        for (const auto &order_index : sorted_index_cl_)
-        {
-            indexes_.insert(contacts_[order_index].Get()->AimId_, i);
-            ++i;
-        }
         is_index_valid_ = true;
     }
 
+    void ContactListModel::reindex(int _from, int _to)
+    {
+        for (auto i = _from; i < _to; ++i)
+            indexes_[contacts_[sorted_index_cl_[i]].Get()->AimId_] = i;
+    }
+
     void ContactListModel::contactList(std::shared_ptr<Data::ContactList> _cl, QString _type)
     {
         const int size = (int)contacts_.size();
@@ -365,46 +371,42 @@ namespace Logic
         }
     }
 
-    int ContactListModel::innerRemoveContact(const QString& _aimId)
+    bool ContactListModel::innerRemoveContact(const QString& _aimId)
     {
-        size_t idx = 0;
-        for ( ; idx < contacts_.size(); ++idx)
+        const auto pos = getOrderIndexByAimid(_aimId);
+        if (pos == -1)
+            return false;
+
+        const auto idx = getIndexByOrderedIndex(pos);
+        if (contacts_[idx].is_live_chat())
+            emit liveChatRemoved(_aimId);
+
+        // the last contact takes the place of the removed one, so only its entry in the order changes
+        const auto lastIdx = (int)contacts_.size() - 1;
+        if (idx != lastIdx)
         {
-            if (contacts_[idx].Get()->AimId_ == _aimId)
-                break;
+            const auto lastPos = getOrderIndexByAimid(contacts_[lastIdx].get_aimid());
+            assert(lastPos != -1);
+
+            contacts_[idx] = std::move(contacts_[lastIdx]);
+            sorted_index_cl_[lastPos] = idx;
         }
 
-        auto cont = contacts_.begin() + idx;
-        if (cont == contacts_.end())
-            return contacts_.size();
+        contacts_.pop_back();
 
-        if (cont->is_live_chat())
-            emit liveChatRemoved(_aimId);
+        sorted_index_cl_.erase(sorted_index_cl_.begin() + pos);
+        indexes_.remove(_aimId);
+        reindex(pos, (int)sorted_index_cl_.size());
 
-        contacts_.erase(cont);
-        is_index_valid_ = false;
-        emit contact_removed(_aimId);
-        return idx;
-    }
+        changedContacts_.remove(_aimId);
 
-    void ContactListModel::updateIndexesListAfterRemoveContact(std::vector<int>& _list, int _index)
-    {
-        _list.erase(std::remove(_list.begin(), _list.end(), _index), _list.end());
-        for (auto& idx : _list)
-        {
-            if (idx > _index)
-            {
-                idx -= 1;
-            }
-        }
+        emit contact_removed(_aimId);
+        return true;
     }
 
     void ContactListModel::contactRemoved(QString _contact)
     {
-        auto removedIdx = innerRemoveContact(_contact);
-        updateIndexesListAfterRemoveContact(sorted_index_cl_, removedIdx);
-        updateIndexesListAfterRemoveContact(sorted_index_recents_, removedIdx);
-        rebuild_index();
+        innerRemoveContact(_contact);
         updatePlaceholders();
     }
 
@@ -429,12 +431,12 @@ namespace Logic
         auto idx = getOrderIndexByAimid(_presence->AimId_);
         if (idx != -1)
         {
-            auto contact = contacts_[getIndexByOrderedIndex(idx)].Get();
-            contact->ApplyBuddy(_presence);
+            auto& contact = contacts_[getIndexByOrderedIndex(idx)];
+            contact.Get()->ApplyBuddy(_presence);
+            contact.update_sort_name();
             pushChange(idx);
             emit contactChanged(_presence->AimId_);
-            if (!timer_->isActive())
-                timer_->start();
+            scheduleSort(_presence->AimId_);
         }
     }
 
@@ -533,11 +535,101 @@ namespace Logic
 
     void ContactListModel::sort()
     {
+        changedContacts_.clear();
+
         if (!contacts_.size())
+        {
+            sorted_index_cl_.clear();
             return;
+        }
         updateSortedIndexesList(sorted_index_cl_, getLessFuncCL(QDateTime::currentDateTime()));
     }
 
+    void ContactListModel::scheduleSort(const QString& _aimId)
+    {
+        changedContacts_.insert(_aimId);
+
+        if (!timer_->isActive())
+            timer_->start();
+    }
+
+    void ContactListModel::sortChanged()
+    {
+        if (changedContacts_.isEmpty())
+            return;
+
+        if (changedContacts_.size() * FULL_SORT_RATIO > (int)contacts_.size())
+        {
+            refresh();
+            return;
+        }
+
+        const auto size = (int)sorted_index_cl_.size();
+
+        // the orders before first and after last stay as they were
+        auto first = size;
+        auto tail = size;
+
+        std::vector<int> changed;
+        changed.reserve(changedContacts_.size());
+
+        for (const auto& aimId : changedContacts_)
+        {
+            const auto pos = getOrderIndexByAimid(aimId);
+            if (pos == -1)
+                continue;
+
+            changed.push_back(getIndexByOrderedIndex(pos));
+
+            first = std::min(first, pos);
+            tail = std::min(tail, size - 1 - pos);
+        }
+
+        changedContacts_.clear();
+
+        if (changed.empty())
+            return;
+
+        // the rest of the list stays sorted, the changed contacts are taken out and put back at their places
+        std::sort(changed.begin(), changed.end());
+
+        sorted_index_cl_.erase(std::remove_if(sorted_index_cl_.begin(), sorted_index_cl_.end(), [&changed](int _idx)
+        {
+            return std::binary_search(changed.begin(), changed.end(), _idx);
+        }), sorted_index_cl_.end());
+
+        const auto less = getLessFuncCL(QDateTime::currentDateTime());
+
+        for (const auto idx : changed)
+        {
+            auto iter = std::upper_bound(sorted_index_cl_.begin(), sorted_index_cl_.end(), idx, [&less, this](int _first, int _second)
+            {
+                return less(contacts_[_first], contacts_[_second]);
+            });
+
+            const auto pos = (int)std::distance(sorted_index_cl_.begin(), iter);
+
+            first = std::min(first, pos);
+            tail = std::min(tail, (int)sorted_index_cl_.size() - pos);
+
+            sorted_index_cl_.insert(iter, idx);
+        }
+
+        const auto last = size - 1 - tail;
+
+        reindex(first, last + 1);
+
+        int visibleCount = -1;
+        getAbsIndexByVisibleIndex(first, &visibleCount, first);
+        const auto firstRow = visibleCount + 1;
+
+        getAbsIndexByVisibleIndex(last + 1, &visibleCount, last + 1);
+        const auto lastRow = visibleCount;
+
+        if (firstRow <= lastRow)
+            emit dataChanged(index(firstRow), index(lastRow));
+    }
+
     std::function<bool (const Logic::ContactItem&, const Logic::ContactItem&)> ContactListModel::getLessFuncCL(const QDateTime& current) const
     {
         std::function<bool (const Logic::ContactItem&, const Logic::ContactItem&)> less = ItemLessThanNoGroups(current);
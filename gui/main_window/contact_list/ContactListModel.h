@@ -35,7 +35,7 @@ namespace Logic
                 if (second.is_group())
                     return false;
 
-                return first.Get()->GetDisplayName().toUpper() < second.Get()->GetDisplayName().toUpper();
+                return first.get_sort_name() < second.get_sort_name();
             }
 
             return first.Get()->GroupId_ < second.Get()->GroupId_;
@@ -77,6 +77,7 @@ namespace Logic
         void scrolled(int);
         void dlgStates(std::shared_ptr<QList<Data::DlgState>>);
         void contactRemoved(QString);
+        void sortChanged();
 
 
     public Q_SLOTS:
@@ -158,23 +159,26 @@ namespace Logic
         std::shared_ptr<bool>	ref_;
         std::function<void(Ui::HistoryControlPage*)> gotPageCallback_;
         void rebuild_index();
+        void reindex(int _from, int _to);
         int addItem(Data::Contact* _contact);
         void pushChange(int i);
         void processChanges();
         void sort();
+        void scheduleSort(const QString& _aimId);
         bool isVisibleItem(const ContactItem& _item);
         int getIndexByOrderedIndex(int _index) const;
         int getOrderIndexByAimid(const QString& _aimId) const;
         void updateSortedIndexesList(std::vector<int>& _list, std::function<bool (const Logic::ContactItem&, const Logic::ContactItem&)> _less);
         std::function<bool (const Logic::ContactItem&, const Logic::ContactItem&)> getLessFuncCL(const QDateTime& current) const;
-        void updateIndexesListAfterRemoveContact(std::vector<int>& _list, int _index);
-        int innerRemoveContact(const QString& _aimId);
+        bool innerRemoveContact(const QString& _aimId);
 
         std::vector<ContactItem> contacts_;
         std::vector<int> sorted_index_cl_;
-        std::vector<int> sorted_index_recents_;
         QHash<QString, int> indexes_;
 
+        // the contacts changed since the last sort, put back at their places by sortChanged
+        QSet<QString> changedContacts_;
+
         int scrollPosition_;
         mutable int minVisibleIndex_;
         mutable int maxVisibleIndex_;
@@ -0,0 +1,172 @@
+#include "stdafx.h"
+#include "ItemRasterCache.h"
+
+namespace
+{
+    const int64_t STATS_TRACE_LOOKUPS = 5000;
+
+    bool IsSamePixelRatio(const qreal _first, const qreal _second)
+    {
+        return qFuzzyCompare(_first, _second);
+    }
+}
+
+namespace ContactList
+{
+    ItemRasterCacheStats::ItemRasterCacheStats()
+        : Hits_(0)
+        , Misses_(0)
+        , Evictions_(0)
+        , Bytes_(0)
+        , Budget_(0)
+        , Entries_(0)
+    {
+    }
+
+    ItemStateHash::ItemStateHash()
+        : Value_(0)
+    {
+    }
+
+    ItemStateHash& ItemStateHash::operator<<(const bool _value)
+    {
+        return (*this << (int)_value);
+    }
+
+    ItemStateHash& ItemStateHash::operator<<(const QPixmap& _pixmap)
+    {
+        // the key of a pixmap changes whenever its content does
+        return (*this << _pixmap.cacheKey());
+    }
+
+    uint ItemStateHash::value() const
+    {
+        return Value_;
+    }
+
+    ItemRasterCache::Entry::Entry(const QString& _key)
+        : Key_(_key)
+        , StateHash_(0)
+        , PixelRatio_(1)
+        , Bytes_(0)
+    {
+    }
+
+    ItemRasterCache::ItemRasterCache(const int64_t _budgetBytes)
+    {
+        assert(_budgetBytes > 0);
+
+        Stats_.Budget_ = _budgetBytes;
+    }
+
+    const QPixmap& ItemRasterCache::Get(const QString& _key, const uint _stateHash, const QSize& _size, const qreal _pixelRatio, const Renderer& _render)
+    {
+        assert(!_key.isEmpty());
+        assert(_render);
+
+        if (((Stats_.Hits_ + Stats_.Misses_ + 1) % STATS_TRACE_LOOKUPS) == 0)
+        {
+            TraceStats();
+        }
+
+        auto iter = Index_.find(_key);
+        if (iter == Index_.end())
+        {
+            Lru_.emplace_front(_key);
+            iter = Index_.insert(_key, Lru_.begin());
+
+            ++Stats_.Entries_;
+        }
+        else
+        {
+            Lru_.splice(Lru_.begin(), Lru_, iter.value());
+        }
+
+        auto &entry = *iter.value();
+
+        if (!entry.Pixmap_.isNull() && entry.StateHash_ == _stateHash && entry.Size_ == _size && IsSamePixelRatio(entry.PixelRatio_, _pixelRatio))
+        {
+            ++Stats_.Hits_;
+            return entry.Pixmap_;
+        }
+
+        ++Stats_.Misses_;
+
+        // the kept pixmap is reused when the row keeps its size, only the content is painted again
+        if (entry.Size_ != _size || !IsSamePixelRatio(entry.PixelRatio_, _pixelRatio) || entry.Pixmap_.isNull())
+        {
+            entry.Pixmap_ = QPixmap(_size * _pixelRatio);
+            entry.Pixmap_.setDevicePixelRatio(_pixelRatio);
+        }
+
+        entry.Pixmap_.fill(Qt::transparent);
+
+        {
+            QPainter painter(&entry.Pixmap_);
+            painter.setRenderHint(QPainter::Antialiasing);
+            painter.setRenderHint(QPainter::TextAntialiasing);
+            painter.setRenderHint(QPainter::SmoothPixmapTransform);
+
+            _render(painter);
+        }
+
+        entry.StateHash_ = _stateHash;
+        entry.Size_ = _size;
+        entry.PixelRatio_ = _pixelRatio;
+
+        const auto bytes = ((int64_t)entry.Pixmap_.width() * entry.Pixmap_.height() * std::max(entry.Pixmap_.depth(), 8) / 8);
+        Stats_.Bytes_ += (bytes - entry.Bytes_);
+        entry.Bytes_ = bytes;
+
+        Shrink();
+
+        return entry.Pixmap_;
+    }
+
+    void ItemRasterCache::Clear()
+    {
+        Stats_.Evictions_ += Stats_.Entries_;
+        Stats_.Bytes_ = 0;
+        Stats_.Entries_ = 0;
+
+        Index_.clear();
+        Lru_.clear();
+    }
+
+    const ItemRasterCacheStats& ItemRasterCache::GetStats() const
+    {
+        return Stats_;
+    }
+
+    void ItemRasterCache::Shrink()
+    {
+        // the row just painted is kept even if it alone exceeds the budget
+        while ((Stats_.Bytes_ > Stats_.Budget_) && (Lru_.size() > 1))
+        {
+            const auto &victim = Lru_.back();
+
+            Stats_.Bytes_ -= victim.Bytes_;
+            --Stats_.Entries_;
+            ++Stats_.Evictions_;
+
+            Index_.remove(victim.Key_);
+            Lru_.pop_back();
+        }
+    }
+
+    void ItemRasterCache::TraceStats() const
+    {
+        const auto lookups = (Stats_.Hits_ + Stats_.Misses_);
+
+        __TRACE(
+            "contact_list",
+            "row raster cache stats\n" <<
+            __LOGP(hits, Stats_.Hits_) <<
+            __LOGP(misses, Stats_.Misses_) <<
+            __LOGP(hit_rate, (lookups ? (Stats_.Hits_ * 100 / lookups) : 0)) <<
+            __LOGP(evictions, Stats_.Evictions_) <<
+            __LOGP(entries, Stats_.Entries_) <<
+            __LOGP(bytes, Stats_.Bytes_) <<
+            __LOGP(budget, Stats_.Budget_));
+    }
+}
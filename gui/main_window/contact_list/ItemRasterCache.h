@@ -0,0 +1,94 @@
+#pragma once
+
+namespace ContactList
+{
+    struct ItemRasterCacheStats
+    {
+        ItemRasterCacheStats();
+
+        int64_t Hits_;
+
+        int64_t Misses_;
+
+        int64_t Evictions_;
+
+        int64_t Bytes_;
+
+        int64_t Budget_;
+
+        int32_t Entries_;
+    };
+
+    // the hash of everything a row is painted from, fed field by field
+    class ItemStateHash
+    {
+    public:
+        ItemStateHash();
+
+        template<class T_>
+        ItemStateHash& operator<<(const T_& _value)
+        {
+            Value_ ^= (qHash(_value) + 0x9e3779b9 + (Value_ << 6) + (Value_ >> 2));
+
+            return *this;
+        }
+
+        ItemStateHash& operator<<(const bool _value);
+
+        ItemStateHash& operator<<(const QPixmap& _pixmap);
+
+        uint value() const;
+
+    private:
+        uint Value_;
+    };
+
+    // the painted rows kept as pixmaps, a row is looked up by its item and look (plain, hovered, selected);
+    // the state hash, the size and the pixel ratio tell whether the kept pixmap still shows the item as it is,
+    // otherwise the row is painted again
+    class ItemRasterCache
+    {
+    public:
+        typedef std::function<void(QPainter& _painter)> Renderer;
+
+        explicit ItemRasterCache(const int64_t _budgetBytes);
+
+        const QPixmap& Get(const QString& _key, const uint _stateHash, const QSize& _size, const qreal _pixelRatio, const Renderer& _render);
+
+        void Clear();
+
+        const ItemRasterCacheStats& GetStats() const;
+
+    private:
+        struct Entry
+        {
+            Entry(const QString& _key);
+
+            const QString Key_;
+
+            uint StateHash_;
+
+            QSize Size_;
+
+            qreal PixelRatio_;
+
+            QPixmap Pixmap_;
+
+            int64_t Bytes_;
+        };
+
+        typedef std::list<Entry> EntryList;
+
+        typedef QHash<QString, EntryList::iterator> Index;
+
+        void Shrink();
+
+        void TraceStats() const;
+
+        EntryList Lru_;
+
+        Index Index_;
+
+        ItemRasterCacheStats Stats_;
+    };
+}
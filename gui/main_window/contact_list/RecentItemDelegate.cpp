@@ -15,12 +15,19 @@
 #include "RecentsItemRenderer.h"
 
 #include "../../gui_settings.h"
+#include "../../utils/profiling/timeline.h"
+
+namespace
+{
+    const int64_t ROW_CACHE_BUDGET = (24 * 1024 * 1024);
+}
 
 namespace Logic
 {
 	RecentItemDelegate::RecentItemDelegate(QObject* parent)
 		: AbstractItemDelegateWithRegim(parent)
 		, StateBlocked_(false)
+		, rowCache_(ROW_CACHE_BUDGET)
 	{
 	}
 
@@ -67,6 +74,38 @@ namespace Logic
             return;
         }
 
+		const auto &row = renderItem(option, dlg, painter->device()->devicePixelRatio());
+
+		painter->save();
+		painter->translate(option.rect.topLeft());
+
+		painter->drawPixmap(0, 0, row);
+
+        if (dragOverlay)
+        {
+            painter->setRenderHint(QPainter::Antialiasing);
+            ContactList::RenderRecentsDragOverlay(*painter, viewParams_);
+        }
+
+		painter->restore();
+	}
+
+	void RecentItemDelegate::prerender(const QStyleOptionViewItem &option, const QModelIndex &index, qreal pixelRatio) const
+	{
+		const auto dlg = index.data(Qt::DisplayRole).value<Data::DlgState>();
+        if (dlg.AimId_.isEmpty() || dlg.AimId_ == "snaps" || isServiceItem(dlg))
+            return;
+
+		renderItem(option, dlg, pixelRatio);
+	}
+
+    bool RecentItemDelegate::isServiceItem(const Data::DlgState& dlg) const
+    {
+        return (dlg.AimId_ == "favorites" || dlg.AimId_ == "recents" || dlg.AimId_ == "unknowns" || dlg.AimId_ == "contacts" || dlg.AimId_ == "all messages");
+    }
+
+	const QPixmap& RecentItemDelegate::renderItem(const QStyleOptionViewItem &option, const Data::DlgState& dlg, qreal pixelRatio) const
+	{
 		const auto isMultichat = Logic::getContactListModel()->isChat(dlg.AimId_);
 		auto state = isMultichat ? QString() : Logic::getContactListModel()->getState(dlg.AimId_);
 
@@ -169,18 +208,20 @@ namespace Logic
             visData.IsMailStatus_ = true;
         }
 
-		painter->save();
-		painter->setRenderHint(QPainter::Antialiasing);
-		painter->setRenderHint(QPainter::TextAntialiasing);
-		painter->setRenderHint(QPainter::SmoothPixmapTransform);
-		painter->translate(option.rect.topLeft());
+        // the shown time is taken in, as it is relative to now ("now", "3 min", "yesterday")
+        ContactList::ItemStateHash stateHash;
+        stateHash << dlg.AimId_ << *avatar << state << message << isHovered << isSelected << visData.ContactName_
+            << dlg.Time_ << visData.unreadsCounter_ << visData.Muted_ << dlg.senderNick_ << isOfficial
+            << isDrawLastRead << lastReadAvatar << isTyping << dlg.SearchTerm_ << dlg.HasLastMsgId() << dlg.SearchedMsgId_
+            << visData.IsMailStatus_ << viewParams_.regim_ << viewParams_.fixedWidth_ << viewParams_.leftMargin_
+            << viewParams_.rightMargin_ << viewParams_.pictOnly_ << ContactList::FormatTime(visData.LastSeen_);
 
-		ContactList::RenderRecentsItem(*painter, visData, viewParams_);
+        const auto look = (isSelected ? 2 : (isHovered ? 1 : 0));
 
-        if (dragOverlay)
-            ContactList::RenderRecentsDragOverlay(*painter, viewParams_);
-
-		painter->restore();
+        return rowCache_.Get(dlg.AimId_ + '/' + QString::number(look), stateHash.value(), option.rect.size(), pixelRatio, [this, &visData](QPainter& _painter)
+        {
+            ContactList::RenderRecentsItem(_painter, visData, viewParams_);
+        });
 	}
 
 	void RecentItemDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const
@@ -189,6 +230,14 @@ namespace Logic
         if (dlg.AimId_ == "snaps")
             return;
 
+        // only the first paint after the start is a phase, the later ones skip the timeline
+        static auto isPaintMarked = false;
+        if (!isPaintMarked)
+        {
+            isPaintMarked = true;
+            Profiling::markPhase("gui.recents_painted");
+        }
+
 		return paint(painter, option, dlg, index == DragIndex_);
 	}
 
@@ -254,6 +303,9 @@ namespace Logic
 
     void RecentItemDelegate::setPictOnlyView(bool _pictOnlyView)
     {
+        if (viewParams_.pictOnly_ != _pictOnlyView)
+            rowCache_.Clear();
+
         viewParams_.pictOnly_ = _pictOnlyView;
     }
 
@@ -264,11 +316,17 @@ namespace Logic
 
     void RecentItemDelegate::setFixedWidth(int _newWidth)
     {
+        if (viewParams_.fixedWidth_ != _newWidth)
+            rowCache_.Clear();
+
         viewParams_.fixedWidth_ = _newWidth;
     }
 
     void RecentItemDelegate::setRegim(int _regim)
     {
+        if (viewParams_.regim_ != _regim)
+            rowCache_.Clear();
+
         viewParams_.regim_ = _regim;
     }
 
@@ -3,6 +3,7 @@
 #include "../../types/message.h"
 #include "../../types/typing.h"
 #include "Common.h"
+#include "ItemRasterCache.h"
 
 namespace Logic
 {
@@ -15,6 +16,9 @@ namespace Logic
 		void paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const override;
 		void paint(QPainter *painter, const QStyleOptionViewItem &option, const Data::DlgState& dlgState, bool dragOverlay) const;
 
+		// paints the row into the row cache ahead of time, so scrolling to it takes the kept pixmap
+		void prerender(const QStyleOptionViewItem &option, const QModelIndex &index, qreal pixelRatio) const;
+
 		QSize sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const override;
 		QSize sizeHintForAlert() const;
 
@@ -34,6 +38,10 @@ namespace Logic
 
 	private:
 
+        bool isServiceItem(const Data::DlgState& dlgState) const;
+
+        const QPixmap& renderItem(const QStyleOptionViewItem &option, const Data::DlgState& dlgState, qreal pixelRatio) const;
+
         std::list<TypingFires> typings_;
         
 		struct ItemKey
@@ -52,5 +60,7 @@ namespace Logic
 		bool StateBlocked_;
         QModelIndex DragIndex_;
         ContactList::ViewParams viewParams_;
+
+        mutable ContactList::ItemRasterCache rowCache_;
 	};
 }
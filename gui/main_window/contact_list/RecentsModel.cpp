@@ -14,7 +14,22 @@
 
 namespace
 {
-	static const unsigned SORT_TIMEOUT = (build::is_debug() ? 120000 : 100);
+    // the favorites first in the order they were added, then the recents by the last message
+    bool lessDialogs(const Data::DlgState& _first, const Data::DlgState& _second)
+    {
+        if (_first.FavoriteTime_ == -1 && _second.FavoriteTime_ == -1)
+            return _first.Time_ > _second.Time_;
+
+        if (_first.FavoriteTime_ == -1)
+            return false;
+        else if (_second.FavoriteTime_ == -1)
+            return true;
+
+        if (_first.FavoriteTime_ == _second.FavoriteTime_)
+            return _first.AimId_ > _second.AimId_;
+
+        return _first.FavoriteTime_ < _second.FavoriteTime_;
+    }
 }
 
 namespace Logic
@@ -23,7 +38,6 @@ namespace Logic
 
 	RecentsModel::RecentsModel(QObject *parent)
 		: CustomAbstractListModel(parent)
-		, Timer_(new QTimer(this))
         , FavoritesCount_(0)
         , FavoritesVisible_(true)
         , FavoritesHeadVisible_(true)
@@ -36,8 +50,6 @@ namespace Logic
 		connect(Logic::getContactListModel(), SIGNAL(contactChanged(QString)), this, SLOT(contactChanged(QString)), Qt::QueuedConnection);
         connect(Ui::GetDispatcher(), SIGNAL(favorites(QStringList)), this, SLOT(favorites(QStringList)), Qt::QueuedConnection);
         connect(Logic::getContactListModel(), SIGNAL(contact_removed(QString)), this, SLOT(contactRemoved(QString)), Qt::QueuedConnection);
-		Timer_->setSingleShot(true);
-		connect(Timer_, SIGNAL(timeout()), this, SLOT(sortDialogs()), Qt::QueuedConnection);
 	}
 
 	int RecentsModel::rowCount(const QModelIndex &) const
@@ -121,27 +133,20 @@ namespace Logic
 
 	void RecentsModel::contactChanged(QString aimId)
 	{
-		int i = Indexes_[aimId];
-		if (i != -1)
+		const auto row = dialogRow(Indexes_.value(aimId, -1));
+		if (row != -1)
 		{
-			emit dataChanged(index(i), index(i));
+			emit dataChanged(index(row), index(row));
 		}
 	}
 
 	void RecentsModel::activeDialogHide(QString aimId)
 	{
-		Data::DlgState state;
-		state.AimId_ = aimId;
-		std::vector<Data::DlgState>::iterator iter = std::find(Dialogs_.begin(), Dialogs_.end(), state);
-		if (iter != Dialogs_.end())
+		const auto pos = Indexes_.value(aimId, -1);
+		if (pos != -1)
         {
-            if (iter->FavoriteTime_ != -1)
-                --FavoritesCount_;
+            removeDialog(pos);
 
-            QString hideContact = iter->AimId_;
-            contactChanged(hideContact);
-            Indexes_[iter->AimId_] = -1;
-            Dialogs_.erase(iter);
             if (Logic::getContactListModel()->selectedContact() == aimId)
                 Logic::getContactListModel()->setCurrent("", -1, true);
             if (Dialogs_.empty() && !Logic::getUnknownsModel()->itemsCount())
@@ -155,17 +160,17 @@ namespace Logic
 	{
         bool syncSort = false;
 
-        for (auto _dlgState : *_states)
+        for (const auto& _dlgState : *_states)
         {
             const auto contactItem = Logic::getContactListModel()->getContactItem(_dlgState.AimId_);
 
             if (!_dlgState.Official_ && !_dlgState.Chat_ && (!contactItem || (contactItem && contactItem->is_not_auth())))
                 continue;
 
-            auto iter = std::find(Dialogs_.begin(), Dialogs_.end(), _dlgState);
-            if (iter != Dialogs_.end())
+            const auto pos = Indexes_.value(_dlgState.AimId_, -1);
+            if (pos != -1)
             {
-                auto &existingDlgState = *iter;
+                auto &existingDlgState = Dialogs_[pos];
 
                 if (existingDlgState.FavoriteTime_ != _dlgState.FavoriteTime_)
                 {
@@ -194,14 +199,9 @@ namespace Logic
                     existingDlgState.SetText(existingText);
                 }
 
+                // the whole order is rebuilt below once the favorites have changed
                 if (!syncSort)
-                {
-                    if (!Timer_->isActive())
-                        Timer_->start(SORT_TIMEOUT);
-
-                    int dist = (int)std::distance(Dialogs_.begin(), iter);
-                    emit dataChanged(index(dist), index(dist));
-                }
+                    placeDialog(pos);
             }
             else if (!_dlgState.GetText().isEmpty() || _dlgState.FavoriteTime_ != -1)
             {
@@ -211,16 +211,18 @@ namespace Logic
                     emit favoriteChanged(_dlgState.AimId_);
                 }
 
-                Dialogs_.push_back(_dlgState);
+                // the first dialog and a new favorite bring the headers
+                if (_dlgState.FavoriteTime_ != -1 || Dialogs_.empty())
+                    syncSort = true;
 
-                if (_dlgState.FavoriteTime_ != -1)
+                if (syncSort)
                 {
-                    syncSort = true;
+                    Indexes_[_dlgState.AimId_] = (int) Dialogs_.size();
+                    Dialogs_.push_back(_dlgState);
                 }
                 else
                 {
-                    if (!Timer_->isActive())
-                        Timer_->start(SORT_TIMEOUT);
+                    insertDialog(_dlgState);
                 }
 
                 if (Dialogs_.size() == 1)
@@ -248,68 +250,169 @@ namespace Logic
 
     void RecentsModel::unknownToRecents(Data::DlgState dlgState)
     {
-        auto iter = std::find(Dialogs_.begin(), Dialogs_.end(), dlgState);
-        if (iter == Dialogs_.end() && (!dlgState.GetText().isEmpty() || dlgState.FavoriteTime_ != -1))
+        if (!Indexes_.contains(dlgState.AimId_) && (!dlgState.GetText().isEmpty() || dlgState.FavoriteTime_ != -1))
         {
             if (dlgState.FavoriteTime_ != -1)
             {
                 ++FavoritesCount_;
                 emit favoriteChanged(dlgState.AimId_);
             }
-            Dialogs_.push_back(dlgState);
-            sortDialogs();
+            insertDialog(dlgState);
         }
     }
 
     bool RecentsModel::lessRecents(const QString& _aimid1, const QString& _aimid2)
     {
-        auto first = getDlgState(_aimid1);
-        auto second = getDlgState(_aimid2);
+        const auto first = Indexes_.value(_aimid1, -1);
+        const auto second = Indexes_.value(_aimid2, -1);
 
-        if (first.FavoriteTime_ == -1 && second.FavoriteTime_ == -1)
-            return first.Time_ > second.Time_;
+        if (first != -1 && second != -1)
+            return first < second;
 
-        if (first.FavoriteTime_ == -1)
-            return false;
-        else if (second.FavoriteTime_ == -1)
-            return true;
-
-        if (first.FavoriteTime_ == second.FavoriteTime_)
-            return first.AimId_ > second.AimId_;
-
-        return first.FavoriteTime_ < second.FavoriteTime_;
+        return lessDialogs(getDlgState(_aimid1), getDlgState(_aimid2));
     }
 
 	void RecentsModel::sortDialogs()
 	{
-		std::sort(Dialogs_.begin(), Dialogs_.end(), [this](Data::DlgState first, Data::DlgState second)
+        emit layoutAboutToBeChanged();
+
+		std::sort(Dialogs_.begin(), Dialogs_.end(), lessDialogs);
+
+		Indexes_.clear();
+        reindex(0, (int) Dialogs_.size());
+
+        emit layoutChanged();
+		emit orderChanged();
+	}
+
+    void RecentsModel::reindex(int _from, int _to)
+    {
+        for (auto i = _from; i < _to; ++i)
+            Indexes_[Dialogs_[i].AimId_] = i;
+    }
+
+    void RecentsModel::resetOrder()
+    {
+        Indexes_.clear();
+        reindex(0, (int) Dialogs_.size());
+
+        emit layoutChanged();
+        emit orderChanged();
+    }
+
+    void RecentsModel::placeDialog(int _pos)
+    {
+        assert(_pos >= 0 && _pos < (int) Dialogs_.size());
+
+        const auto begin = Dialogs_.begin();
+        const auto& state = Dialogs_[_pos];
+
+        // the rest of the dialogs stay sorted, the place is searched on the side the dialog went to
+        auto to = _pos;
+        if (_pos > 0 && lessDialogs(state, Dialogs_[_pos - 1]))
+            to = (int) std::distance(begin, std::upper_bound(begin, begin + _pos, state, lessDialogs));
+        else if (_pos + 1 < (int) Dialogs_.size() && lessDialogs(Dialogs_[_pos + 1], state))
+            to = (int) std::distance(begin, std::lower_bound(begin + _pos + 1, Dialogs_.end(), state, lessDialogs)) - 1;
+
+        if (to == _pos)
         {
-            if (first.FavoriteTime_ == -1 && second.FavoriteTime_ == -1)
-                return first.Time_ > second.Time_;
+            const auto row = dialogRow(_pos);
+            if (row != -1)
+                emit dataChanged(index(row), index(row));
 
-            if (first.FavoriteTime_ == -1)
-                return false;
-            else if (second.FavoriteTime_ == -1)
-                return true;
+            return;
+        }
 
-            if (first.FavoriteTime_ == second.FavoriteTime_)
-                return first.AimId_ > second.AimId_;
+        const auto fromRow = dialogRow(_pos);
+        const auto toRow = dialogRow(to);
 
-            return first.FavoriteTime_ < second.FavoriteTime_;
+        // a hidden favorite has no row to move
+        const auto isMoved = (fromRow != -1 && toRow != -1 && beginMoveRows(QModelIndex(), fromRow, fromRow, QModelIndex(), to < _pos ? toRow : toRow + 1));
+        if (!isMoved)
+            emit layoutAboutToBeChanged();
 
-        });
+        if (to < _pos)
+        {
+            std::rotate(begin + to, begin + _pos, begin + _pos + 1);
+            reindex(to, _pos + 1);
+        }
+        else
+        {
+            std::rotate(begin + _pos, begin + _pos + 1, begin + to + 1);
+            reindex(_pos, to + 1);
+        }
 
-		Indexes_.clear();
-		int i = 0;
-		for (auto iter : Dialogs_)
-		{
-			Indexes_[iter.AimId_] = i;
-			++i;
-		}
+        if (!isMoved)
+        {
+            resetOrder();
+            return;
+        }
 
-		emit dataChanged(index(0), index(rowCount()));
-		emit orderChanged();
-	}
+        endMoveRows();
+
+        emit dataChanged(index(toRow), index(toRow));
+        emit orderChanged();
+    }
+
+    void RecentsModel::insertDialog(const Data::DlgState& _state)
+    {
+        // a favorite or the first dialog changes the headers
+        if (_state.FavoriteTime_ != -1 || Dialogs_.empty())
+        {
+            emit layoutAboutToBeChanged();
+
+            Dialogs_.insert(std::upper_bound(Dialogs_.begin(), Dialogs_.end(), _state, lessDialogs), _state);
+
+            resetOrder();
+            return;
+        }
+
+        const auto pos = (int) std::distance(Dialogs_.begin(), std::upper_bound(Dialogs_.begin(), Dialogs_.end(), _state, lessDialogs));
+
+        const auto row = dialogRow(pos);
+
+        beginInsertRows(QModelIndex(), row, row);
+
+        Dialogs_.insert(Dialogs_.begin() + pos, _state);
+        reindex(pos, (int) Dialogs_.size());
+
+        endInsertRows();
+
+        emit orderChanged();
+    }
+
+    void RecentsModel::removeDialog(int _pos)
+    {
+        const auto& state = Dialogs_[_pos];
+        const auto row = dialogRow(_pos);
+
+        // the last dialog and a favorite take the headers away
+        const auto isLayoutChanged = (state.FavoriteTime_ != -1 || Dialogs_.size() == 1 || row == -1);
+        if (isLayoutChanged)
+        {
+            if (state.FavoriteTime_ != -1)
+                --FavoritesCount_;
+
+            emit layoutAboutToBeChanged();
+        }
+        else
+        {
+            beginRemoveRows(QModelIndex(), row, row);
+        }
+
+        Indexes_.remove(state.AimId_);
+        Dialogs_.erase(Dialogs_.begin() + _pos);
+
+        if (isLayoutChanged)
+        {
+            resetOrder();
+            return;
+        }
+
+        reindex(_pos, (int) Dialogs_.size());
+
+        endRemoveRows();
+    }
 
     void RecentsModel::contactRemoved(QString _aimId)
     {
@@ -325,9 +428,9 @@ namespace Logic
 	{
 		QString contact = aimId.isEmpty() ? getContactListModel()->selectedContact() : aimId;
 		Data::DlgState state;
-        auto iter = std::find_if(Dialogs_.begin(), Dialogs_.end(), [&aimId](const Data::DlgState &item) { return (item.AimId_ == aimId); });
-		if (iter != Dialogs_.end())
-			state = *iter;
+        const auto pos = Indexes_.value(aimId, -1);
+		if (pos != -1)
+			state = Dialogs_[pos];
 
 		if (fromDialog)
 			sendLastRead(aimId);
@@ -352,8 +455,12 @@ namespace Logic
 	{
 		Data::DlgState state;
 		state.AimId_ = aimId.isEmpty() ? Logic::getContactListModel()->selectedContact() : aimId;
-		std::vector<Data::DlgState>::iterator iter = std::find(Dialogs_.begin(), Dialogs_.end(), state);
-		if (iter != Dialogs_.end() && (iter->UnreadCount_ != 0 || iter->YoursLastRead_ < iter->LastMsgId_))
+		const auto pos = Indexes_.value(state.AimId_, -1);
+		if (pos == -1)
+			return;
+
+		auto iter = Dialogs_.begin() + pos;
+		if (iter->UnreadCount_ != 0 || iter->YoursLastRead_ < iter->LastMsgId_)
 		{
 			iter->UnreadCount_ = 0;
 
@@ -362,8 +469,7 @@ namespace Logic
 			collection.set_value_as_int64("message", iter->LastMsgId_);
 			Ui::GetDispatcher()->post_message_to_core("dlg_state/set_last_read", collection.get());
 
-			int ind = (int)std::distance(Dialogs_.begin(), iter);
-			emit dataChanged(index(ind), index(ind));
+			contactChanged(state.AimId_);
 			emit updated();
 		}
 	}
@@ -379,8 +485,7 @@ namespace Logic
 				collection.set_value_as_int64("message", iter->LastMsgId_);
 				Ui::GetDispatcher()->post_message_to_core("dlg_state/set_last_read", collection.get());
 
-				int ind = (int)std::distance(Dialogs_.begin(), iter);
-				emit dataChanged(index(ind), index(ind));
+				contactChanged(iter->AimId_);
 				emit updated();
 			}
 		}
@@ -404,11 +509,9 @@ namespace Logic
 
     bool RecentsModel::isFavorite(const QString& aimid) const
     {
-        Data::DlgState state;
-        state.AimId_ = aimid;
-        std::vector<Data::DlgState>::const_iterator iter = std::find(Dialogs_.begin(), Dialogs_.end(), state);
-        if (iter != Dialogs_.end())
-            return iter->FavoriteTime_ != -1;
+        const auto pos = Indexes_.value(aimid, -1);
+        if (pos != -1)
+            return Dialogs_[pos].FavoriteTime_ != -1;
 
         return false;
     }
@@ -447,43 +550,44 @@ namespace Logic
 
 	QModelIndex RecentsModel::contactIndex(const QString& aimId)
 	{
-		int i = 0;
-		for (auto iter : Dialogs_)
-		{
-			if (iter.AimId_ == aimId)
-            {
-                break;
-            }
-			++i;
-		}
+        const auto row = dialogRow(Indexes_.value(aimId, -1));
+        if (row != -1)
+		    return index(row);
+
+		return QModelIndex();
+	}
+
+    int RecentsModel::dialogRow(int _pos) const
+    {
+        if (_pos < 0)
+            return -1;
 
-        if (i < (int)Dialogs_.size())
+        auto i = _pos;
+        if (FavoritesCount_)
         {
-            if (FavoritesCount_)
-            {
-                if (i >= visibleContactsInFavorites())
-                {
-                    ++i;
-                    if (!FavoritesVisible_)
-                        i -= FavoritesCount_;
-                }
-                if (FavoritesHeadVisible_)
-                    ++i;
-            }
-            else
+            if (i >= visibleContactsInFavorites())
             {
+                if (!FavoritesVisible_ && i < FavoritesCount_)
+                    return -1;
+
                 ++i;
+                if (!FavoritesVisible_)
+                    i -= FavoritesCount_;
             }
-
-            int result = i + getSizeOfUnknownBlock();
-            if (SnapsVisible_)
-                ++result;
-
-		    return index(result);
+            if (FavoritesHeadVisible_)
+                ++i;
+        }
+        else
+        {
+            ++i;
         }
 
-		return QModelIndex();
-	}
+        int result = i + getSizeOfUnknownBlock();
+        if (SnapsVisible_)
+            ++result;
+
+        return result;
+    }
 
     QString RecentsModel::firstContact()
     {
@@ -543,30 +647,18 @@ namespace Logic
 
     QString RecentsModel::nextAimId(QString aimId)
     {
-        for (int i = 0; i < (int) Dialogs_.size(); i++)
-        {
-            Data::DlgState iter = Dialogs_.at(i);
-            if (iter.AimId_ == aimId &&
-                i < (int) Dialogs_.size() - 1)
-            {
-                return Dialogs_.at(i + 1).AimId_;
-            }
-        }
+        const auto i = Indexes_.value(aimId, -1);
+        if (i != -1 && i < (int) Dialogs_.size() - 1)
+            return Dialogs_.at(i + 1).AimId_;
 
         return "";
     }
 
     QString RecentsModel::prevAimId(QString aimId)
     {
-        for (int i = 0; i < (int) Dialogs_.size(); i++)
-        {
-            Data::DlgState iter = Dialogs_.at(i);
-            if (iter.AimId_ == aimId &&
-                i > 0)
-            {
-                return Dialogs_.at(i - 1).AimId_;
-            }
-        }
+        const auto i = Indexes_.value(aimId, -1);
+        if (i > 0)
+            return Dialogs_.at(i - 1).AimId_;
 
         return "";
     }
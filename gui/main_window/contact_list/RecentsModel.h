@@ -91,9 +91,19 @@ namespace Logic
         int getRecentsHeaderIndex() const;
         int getVisibleServiceItemInFavorites() const;
 
+        // the row of the dialog at _pos (or of a recent about to be inserted there), -1 for a hidden favorite
+        int dialogRow(int _pos) const;
+        void reindex(int _from, int _to);
+        void resetOrder();
+
+        // moves the changed dialog at _pos to its place, the other rows stay
+        void placeDialog(int _pos);
+        void insertDialog(const Data::DlgState& _state);
+        void removeDialog(int _pos);
+
+        // sorted by lessDialogs, Indexes_ holds the position of every dialog
 		std::vector<Data::DlgState> Dialogs_;
 		QHash<QString, int> Indexes_;
-		QTimer* Timer_;
         quint16 FavoritesCount_;
         bool FavoritesVisible_;
         bool FavoritesHeadVisible_;
@@ -29,7 +29,7 @@
 #include "../../../themes/ResourceIds.h"
 #include "../../../utils/InterConnector.h"
 #include "../../../utils/LoadMovieFromFileTask.h"
-#include "../../../utils/LoadPixmapFromFileTask.h"
+#include "../../../utils/ImageDecodePool.h"
 #include "../../../utils/utils.h"
 #include "../../../utils/log/log.h"
 
@@ -1078,15 +1078,18 @@ namespace HistoryControl
             return false;
         }
 
-        auto task = new Utils::LoadPixmapFromFileTask(FsInfo_->GetLocalPath());
+        const auto &localPath = FsInfo_->GetLocalPath();
+        const auto maxSize = Style::Preview::getImageDecodeSizeMax();
 
-        QObject::connect(
-            task,
-            &Utils::LoadPixmapFromFileTask::loadedSignal,
+        Utils::GetImageDecodePool()->decode(
+            QString("%1|%2x%3").arg(localPath).arg(maxSize.width()).arg(maxSize.height()),
+            Utils::DecodePriority::NearViewport,
             this,
-            &FileSharingWidget::localPreviewLoaded);
-
-        QThreadPool::globalInstance()->start(task);
+            Utils::makeFileDecoder(localPath, maxSize),
+            [this](QPixmap pixmap)
+            {
+                localPreviewLoaded(pixmap);
+            });
 
 		return true;
 	}
@@ -1504,7 +1507,7 @@ namespace HistoryControl
 		}
 
         assert(PreviewDownloadId_ == -1);
-        PreviewDownloadId_ = Ui::GetDispatcher()->downloadImage(previewUri, "#", QString(), false, 0, 0);
+        PreviewDownloadId_ = Ui::GetDispatcher()->downloadImage(previewUri, "#", QString(), false, 0, 0, false, Style::Preview::getImageDecodeSizeMax(), this);
 	}
 
     void FileSharingWidget::requestPreviewMetainfo()
@@ -4,6 +4,7 @@
 #include "../../../themes/ThemePixmap.h"
 #include "../../../themes/ResourceIds.h"
 #include "../../../theme_settings.h"
+#include "../../../utils/ImageDecodePool.h"
 #include "../../../utils/log/log.h"
 #include "../../../utils/PainterPath.h"
 #include "../../../utils/Text.h"
@@ -14,7 +15,6 @@
 #include "../complex_message/Style.h"
 #include "../MessageStatusWidget.h"
 #include "../MessageStyle.h"
-#include "../ResizePixmapTask.h"
 
 #include "PreviewContentWidget.h"
 
@@ -153,7 +153,7 @@ namespace HistoryControl
 
                 if (videoPlayer_->state() == QMovie::MovieState::Paused && videoPlayer_->isGif())
                 {
-                    p.drawPixmap(imageRect, videoPlayer_->getActiveImage());
+                    p.drawImage(imageRect, videoPlayer_->getActiveImage());
                 }
             }
         }
@@ -606,15 +606,15 @@ namespace HistoryControl
 
         const auto scaledSize = Utils::scale_bitmap(getMaxPreviewSize().toSize());
 
-        auto task = new ResizePixmapTask(Preview_, scaledSize);
-
-        const auto succeed = QObject::connect(
-            task, &ResizePixmapTask::resizedSignal,
-            this, &PreviewContentWidget::onPreviewSizeLimited
-        );
-        assert(succeed);
-
-        QThreadPool::globalInstance()->start(task);
+        Utils::GetImageDecodePool()->decode(
+            QString(),
+            Utils::DecodePriority::NearViewport,
+            this,
+            Utils::makeResizeDecoder(Preview_, scaledSize),
+            [this](QPixmap preview)
+            {
+                onPreviewSizeLimited(preview);
+            });
     }
 
     void PreviewContentWidget::invalidateSizes()
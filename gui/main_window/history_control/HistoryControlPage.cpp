@@ -686,6 +686,11 @@ namespace Ui
             this, &HistoryControlPage::onReachedFetchingDistance
         );
 
+        QObject::connect(
+            messagesArea_, &MessagesScrollArea::prefetchRequestedEvent,
+            this, &HistoryControlPage::onPrefetchRequested
+        );
+
         QObject::connect(messagesArea_, &MessagesScrollArea::needCleanup, this, &HistoryControlPage::unloadWidgets);
 
         QObject::connect(messagesArea_, &MessagesScrollArea::scrollMovedToBottom, this, &HistoryControlPage::scrollMovedToBottom);
@@ -2005,6 +2010,11 @@ namespace Ui
         requestMoreMessagesAsync(__FUNCLINEA__, _isMoveToBottomIfNeed);
     }
 
+    void HistoryControlPage::onPrefetchRequested(int32_t _pages)
+    {
+        Logic::GetMessagesModel()->prefetchOlder(aimId_, _pages);
+    }
+
     void HistoryControlPage::fetchMore(QString _aimId)
     {
         if (_aimId != aimId_)
@@ -226,6 +226,7 @@ Q_SIGNALS:
         void chatInfoFailed(qint64 _seq, core::group_chat_info_errors);
         void updateChatInfo();
         void onReachedFetchingDistance(bool _isMoveToBottomIfNeed = true);
+        void onPrefetchRequested(int32_t _pages);
         void fetchMore(QString);
         void nameClicked();
         void editMembers();
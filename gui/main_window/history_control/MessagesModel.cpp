@@ -17,7 +17,10 @@
 #include "../history_control/VoipEventItem.h"
 #include "../history_control/complex_message/ComplexMessageItem.h"
 #include "../history_control/complex_message/ComplexMessageItemBuilder.h"
+#include "../history_control/complex_message/Style.h"
+#include "../history_control/complex_message/TextChunk.h"
 
+#include "../../cache/previews/PreviewCache.h"
 #include "../../core_dispatcher.h"
 #include "../../gui_settings.h"
 #include "../../my_info.h"
@@ -29,6 +32,17 @@
 
 namespace
 {
+    // the prefetched messages kept in the model above the widgets, in pages
+    const int32_t MAX_PREFETCH_PAGES = 4;
+
+    // the dialogs without a history page are dropped once not visited for this long
+    const int64_t DIALOG_IDLE_TIMEOUT_MS = (build::is_debug() ? 10000 : 300000);
+
+    const int32_t DIALOG_EVICTION_INTERVAL_MS = (build::is_debug() ? 5000 : 60000);
+
+    // the pool is started over past this size, the strings taken from it stay shared
+    const int32_t MAX_POOLED_STRINGS = 4096;
+
     QString NormalizeAimId(const QString& _aimId)
     {
         int pos = _aimId.indexOf("@uin.icq");
@@ -545,6 +559,12 @@ namespace Logic
     // ContactDialog
     //////////////////////////////////////////////////////////////////////////
 
+    ContactDialog::ContactDialog()
+        : recvLastMessage_(false)
+        , lastVisit_(QDateTime::currentMSecsSinceEpoch())
+    {
+    }
+
     void ContactDialog::setLastRequestedMessage(const qint64 _message)
     {
         if (!lastRequestedMessage_)
@@ -769,6 +789,16 @@ namespace Logic
         return recvLastMessage_;
     }
 
+    void ContactDialog::visit()
+    {
+        lastVisit_ = QDateTime::currentMSecsSinceEpoch();
+    }
+
+    int64_t ContactDialog::getLastVisit() const
+    {
+        return lastVisit_;
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // MessagesModel
     //////////////////////////////////////////////////////////////////////////
@@ -777,8 +807,16 @@ namespace Logic
 
     MessagesModel::MessagesModel(QObject *parent)
         : QObject(parent)
+        , evictionTimer_(new QTimer(this))
         , itemWidth_(0)
     {
+        evictionTimer_->setInterval(DIALOG_EVICTION_INTERVAL_MS);
+        evictionTimer_->setSingleShot(false);
+
+        connect(evictionTimer_, &QTimer::timeout, this, &MessagesModel::evictDialogs);
+
+        evictionTimer_->start();
+
         connect(
             Ui::GetDispatcher(),
             &Ui::core_dispatcher::messageBuddies,
@@ -822,6 +860,67 @@ namespace Logic
             Qt::DirectConnection);
     }
 
+    void MessagesModel::evictDialogs()
+    {
+        const auto now = QDateTime::currentMSecsSinceEpoch();
+
+        for (auto iter = dialogs_.begin(); iter != dialogs_.end();)
+        {
+            const auto &aimId = iter.key();
+            const auto &dialog = *iter.value();
+
+            // a dialog with a history page keeps its messages until the page is closed
+            const auto isIdle = (
+                !requestedContact_.contains(aimId) &&
+                !dialog.hasPending() &&
+                ((now - dialog.getLastVisit()) >= DIALOG_IDLE_TIMEOUT_MS));
+
+            if (!isIdle)
+            {
+                ++iter;
+                continue;
+            }
+
+            prefetchPages_.remove(aimId);
+            subscribed_.removeAll(aimId);
+
+            iter = dialogs_.erase(iter);
+        }
+
+        if (dialogs_.isEmpty())
+        {
+            strings_.clear();
+        }
+    }
+
+    const QString& MessagesModel::internString(const QString& _value)
+    {
+        if (strings_.size() >= MAX_POOLED_STRINGS)
+        {
+            strings_.clear();
+        }
+
+        return *strings_.insert(_value);
+    }
+
+    void MessagesModel::compactBuddies(Data::MessageBuddies& _buddies)
+    {
+        for (auto &buddy : _buddies)
+        {
+            buddy->AimId_ = internString(buddy->AimId_);
+
+            if (!buddy->ChatFriendly_.isEmpty())
+            {
+                buddy->ChatFriendly_ = internString(buddy->ChatFriendly_);
+            }
+
+            if (buddy->HasChatSender())
+            {
+                buddy->SetChatSender(internString(buddy->GetChatSender()));
+            }
+        }
+    }
+
     void MessagesModel::dlgStates(std::shared_ptr<QList<Data::DlgState>> _states)
     {
         for (auto _state : *_states)
@@ -1080,6 +1179,8 @@ namespace Logic
         assert(_option < Ui::MessagesBuddiesOpt::Max);
         assert(_buddies);
 
+        compactBuddies(*_buddies);
+
         const auto isDlgState = (_option == Ui::MessagesBuddiesOpt::DlgState || _option == Ui::MessagesBuddiesOpt::Init || _option == Ui::MessagesBuddiesOpt::MessageStatus);
         const auto isPending = (_option == Ui::MessagesBuddiesOpt::Pending);
 
@@ -1149,6 +1250,12 @@ namespace Logic
                 getContactDialog(_aimId).setLastRequestedMessage(-1);
             }
 
+            // the beginning of the history is reached
+            if (_option == Ui::MessagesBuddiesOpt::Requested)
+            {
+                prefetchPages_.remove(_aimId);
+            }
+
             updateMessagesMarginsAndAvatars(_aimId);
 
             return;
@@ -1190,6 +1297,13 @@ namespace Logic
         {
             updateLastSeen(_aimId);
         }
+
+        if (isRequested && prefetchPages_.contains(_aimId))
+        {
+            warmMediaPreviews(*_buddies);
+
+            continuePrefetch(_aimId);
+        }
     }
 
     void MessagesModel::updateLastSeen(const QString& _aimid)
@@ -1787,6 +1901,8 @@ namespace Logic
         auto& dialog = getContactDialog(_aimId);
         auto& dialogMessages = dialog.getMessages();
 
+        dialog.visit();
+
         qint64 lastId = dialogMessages.empty() ? -1 : dialogMessages.begin()->second.getBuddy()->Id_;
         qint64 lastPrev = dialogMessages.empty() ? -1 : dialogMessages.begin()->second.getBuddy()->Prev_;
 
@@ -2120,6 +2236,8 @@ namespace Logic
         auto& dialogMessages = dialog.getMessages();
         auto& pendingMessages = dialog.getPendingMessages();
 
+        dialog.visit();
+
         if (!_is_jump_to_bottom && dialogMessages.empty() && pendingMessages.empty())
             return result;
 
@@ -2210,6 +2328,8 @@ namespace Logic
         auto& dialogMessages = dialog.getMessages();
         auto& pendingMessages = dialog.getPendingMessages();
 
+        dialog.visit();
+
         if (dialog.getLastKey().isEmpty())
             return tail(aimId, parent, false /* _is_search */, -1 /* _mess_id */);
 
@@ -2405,6 +2525,8 @@ namespace Logic
     {
         dialogs_.remove(_aimId);
 
+        prefetchPages_.remove(_aimId);
+
         requestedContact_.removeAll(_aimId);
     }
 
@@ -2654,6 +2776,73 @@ namespace Logic
         emit quote(quote_id);
     }
 
+    void MessagesModel::prefetchOlder(const QString& _aimId, const int32_t _pages)
+    {
+        assert(!_aimId.isEmpty());
+        assert(_pages > 0);
+
+        prefetchPages_[_aimId] = std::min(_pages, MAX_PREFETCH_PAGES);
+
+        continuePrefetch(_aimId);
+    }
+
+    void MessagesModel::continuePrefetch(const QString& _aimId)
+    {
+        auto iterPages = prefetchPages_.find(_aimId);
+        if (iterPages == prefetchPages_.end())
+        {
+            return;
+        }
+
+        auto iterDialog = dialogs_.find(_aimId);
+        if (iterDialog == dialogs_.end() || (*iterDialog)->getFirstKey().isEmpty())
+        {
+            prefetchPages_.erase(iterPages);
+            return;
+        }
+
+        auto& dialog = **iterDialog;
+        auto& dialogMessages = dialog.getMessages();
+
+        const auto prefetched = std::distance(dialogMessages.begin(), dialogMessages.lower_bound(dialog.getFirstKey()));
+
+        // the prefetch is over once the wanted pages are in the model, the pages are unloaded with their widgets
+        if (prefetched >= (iterPages.value() * preloadCount()))
+        {
+            prefetchPages_.erase(iterPages);
+            return;
+        }
+
+        // a page already asked for is not asked again
+        requestMessages(_aimId, -1 /* _messageId */, true /* _toOlder */, true /* _needPrefetch */, false /* _is_jump_to_bottom */);
+    }
+
+    void MessagesModel::warmMediaPreviews(const Data::MessageBuddies& _buddies) const
+    {
+        const auto previewSize = Ui::ComplexMessage::Style::Preview::getImageDecodeSizeMax();
+
+        for (const auto &buddy : _buddies)
+        {
+            if (!buddy->IsBase() || buddy->IsDeleted())
+            {
+                continue;
+            }
+
+            Ui::ComplexMessage::ChunkIterator it(buddy->GetText());
+            while (it.hasNext())
+            {
+                const auto chunk = it.current();
+
+                if (chunk.Type_ == Ui::ComplexMessage::TextChunk::Type::ImageLink)
+                {
+                    Logic::GetPreviewCache()->Warm(chunk.text_, previewSize);
+                }
+
+                it.next();
+            }
+        }
+    }
+
     ContactDialog& MessagesModel::getContactDialog(const QString& _aimid)
     {
         auto iter = dialogs_.find(_aimid);
@@ -299,11 +299,11 @@ namespace Logic
         MessageKey firstKey_;
         bool recvLastMessage_;
 
+        int64_t lastVisit_;
+
     public:
 
-        ContactDialog() 
-            : recvLastMessage_(false)
-        {}
+        ContactDialog();
 
         void setLastRequestedMessage(const qint64 _message);
         qint64 getLastRequestedMessage() const;
@@ -336,6 +336,10 @@ namespace Logic
 
         void setRecvLastMessage(bool _value);
         bool getRecvLastMessage() const;
+
+        // the last time the history of the dialog was shown or asked for
+        void visit();
+        int64_t getLastVisit() const;
     };
 
     class MessagesModel : public QObject
@@ -376,6 +380,8 @@ namespace Logic
         void dlgStates(std::shared_ptr<QList<Data::DlgState>>);
         void fileSharingUploadingResult(QString seq, bool success, QString localPath, QString uri, int contentType, bool isFileTooBig);
 
+        void evictDialogs();
+
     public Q_SLOTS:
         void messagesDeletedUpTo(QString, int64_t);
         void setRecvLastMsg(QString _aimId, bool _value);
@@ -417,6 +423,9 @@ namespace Logic
 
         void emitQuote(int64_t quote_id);
 
+        // the older pages the user is about to scroll to are asked from the core ahead of the widgets
+        void prefetchOlder(const QString& _aimId, const int32_t _pages);
+
     private:
 
         Data::MessageBuddy item(const Message& _index);
@@ -465,6 +474,12 @@ namespace Logic
 
         void updateLastSeen(const QString& _aimid);
 
+        void compactBuddies(Data::MessageBuddies& _buddies);
+        const QString& internString(const QString& _value);
+
+        void continuePrefetch(const QString& _aimId);
+        void warmMediaPreviews(const Data::MessageBuddies& _buddies) const;
+
     private:
 
         QHash<QString, std::shared_ptr<ContactDialog>> dialogs_;
@@ -476,6 +491,15 @@ namespace Logic
 
         QHash<qint64, int64_t> seqAndToOlder_;
         QHash<qint64, int64_t> seqAndJumpBottom_;
+
+        // the pages wanted above the oldest message widget, by dialog
+        QHash<QString, int32_t> prefetchPages_;
+
+        // the aimids and names repeated in every message share a single copy
+        QSet<QString> strings_;
+
+        QTimer* evictionTimer_;
+
         int32_t itemWidth_;
     };
 
@@ -28,6 +28,8 @@ namespace
 
     double getMaximumSpeed();
 
+    double getMinimumPrefetchSpeed();
+
     template<class T>
     T sign(const T value)
     {
@@ -55,6 +57,13 @@ namespace
 
     const auto IDLE_USER_ACTIVITY_TIMEOUT_MS = (build::is_debug() ? 1000 : 10000);
 
+    // the history the user is going to reach within this time is asked for in advance
+    const auto PREFETCH_HORIZON_MS = 3000;
+
+    const auto SCROLL_VELOCITY_RESET_MS = 300;
+
+    const auto SCROLL_VELOCITY_SMOOTHING = 0.3;
+
     const auto scrollEasing = expoOut;
 }
 
@@ -86,6 +95,8 @@ namespace Ui
         , Layout_(new MessagesScrollAreaLayout(this, Scrollbar_, typingWidget))
         , IsSearching_(false)
         , scrollValue_(-1)
+        , LastScrollMoment_(MOMENT_UNINITIALIZED)
+        , UpwardScrollVelocity_(0)
     {
         assert(parent);
         assert(Layout_);
@@ -863,6 +874,8 @@ namespace Ui
     {
         assert(value >= 0);
 
+        updateScrollVelocity(value);
+
         const auto scrollBounds = Layout_->getViewportScrollBounds();
         const auto absY = Layout_->getViewportAbsY();
 
@@ -875,6 +888,8 @@ namespace Ui
             emit fetchRequestedEvent(true);
         } 
 
+        prefetchAhead(value);
+
         if (Mode_ == ScrollingMode::Selection)
         {
             applySelection();
@@ -1014,6 +1029,61 @@ namespace Ui
         return sign(sum);
     }
 
+    void MessagesScrollArea::updateScrollVelocity(const int32_t value)
+    {
+        const auto now = QDateTime::currentMSecsSinceEpoch();
+
+        // the value also changes when the items above the viewport are inserted or resized, only the user moves count
+        const auto isUserScroll = (isScrolling() || Scrollbar_->isSliderDown() || TouchScrollInProgress_);
+
+        const auto isMomentKnown = (LastScrollMoment_ != MOMENT_UNINITIALIZED);
+        const auto elapsed = (isMomentKnown ? std::max<int64_t>(now - LastScrollMoment_, 1) : 0);
+
+        const auto isMeasured = (
+            isUserScroll &&
+            isMomentKnown &&
+            (scrollValue_ != -1) &&
+            (elapsed <= SCROLL_VELOCITY_RESET_MS));
+
+        LastScrollMoment_ = (isUserScroll ? now : MOMENT_UNINITIALIZED);
+
+        if (!isMeasured)
+        {
+            UpwardScrollVelocity_ = 0;
+            return;
+        }
+
+        const auto velocity = ((scrollValue_ - value) * 1000.0 / elapsed);
+
+        UpwardScrollVelocity_ += ((velocity - UpwardScrollVelocity_) * SCROLL_VELOCITY_SMOOTHING);
+    }
+
+    void MessagesScrollArea::prefetchAhead(const int32_t value)
+    {
+        if (IsSearching_ || (UpwardScrollVelocity_ < getMinimumPrefetchSpeed()))
+        {
+            return;
+        }
+
+        const auto itemsCount = getItemsCount();
+        if (itemsCount == 0)
+        {
+            return;
+        }
+
+        // the pages to come are taken as tall as the loaded ones
+        const auto contentHeight = (Scrollbar_->maximum() + height());
+        const auto pageHeight = std::max(1.0, (double)contentHeight * Data::PRELOAD_MESSAGES_COUNT / itemsCount);
+
+        const auto distanceAhead = ((UpwardScrollVelocity_ * PREFETCH_HORIZON_MS / 1000) - value);
+        if (distanceAhead <= 0)
+        {
+            return;
+        }
+
+        emit prefetchRequestedEvent((int32_t)std::ceil(distanceAhead / pageHeight));
+    }
+
     void MessagesScrollArea::scheduleWheelBufferReset()
     {
         WheelEventsBufferResetTimer_.start();
@@ -1115,6 +1185,11 @@ namespace
         return Utils::scale_value(3000);
     }
 
+    double getMinimumPrefetchSpeed()
+    {
+        return Utils::scale_value(300);
+    }
+
     double cubicOut(const double scrollDistance, const double maxScrollDistance, const double minSpeed, const double maxSpeed)
     {
         assert(maxScrollDistance > 0);
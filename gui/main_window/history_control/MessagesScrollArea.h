@@ -22,6 +22,8 @@ namespace Ui
     Q_SIGNALS:
         void fetchRequestedEvent(bool _isMoveToBottomIfNeed = true);
 
+        void prefetchRequestedEvent(int32_t _pages);
+
         void needCleanup(QList<Logic::MessageKey> keysToUnload);
 
         void scrollMovedToBottom();
@@ -182,6 +184,11 @@ namespace Ui
 
         QTimer WheelEventsBufferResetTimer_;
 
+        int64_t LastScrollMoment_;
+
+        // px per second, smoothed over the last scroll steps
+        double UpwardScrollVelocity_;
+
         void applySelection(const bool forShift = false);
 
         bool enqueWheelEvent(const int32_t delta);
@@ -192,6 +199,10 @@ namespace Ui
 
         int32_t evaluateWheelHistorySign() const;
 
+        void updateScrollVelocity(const int32_t value);
+
+        void prefetchAhead(const int32_t value);
+
         void scheduleWheelBufferReset();
 
         void startScrollAnimation(const ScrollingMode mode);
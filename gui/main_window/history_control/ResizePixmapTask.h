@@ -1,27 +0,0 @@
-#pragma once
-
-namespace HistoryControl
-{
-
-    class ResizePixmapTask
-        : public QObject
-        , public QRunnable
-    {
-        Q_OBJECT
-
-    Q_SIGNALS:
-        void resizedSignal(QPixmap);
-
-    public:
-        ResizePixmapTask(const QPixmap &preview, const QSize &size);
-
-        void run();
-
-    private:
-        QPixmap Preview_;
-
-        QSize Size_;
-
-    };
-
-}
\ No newline at end of file
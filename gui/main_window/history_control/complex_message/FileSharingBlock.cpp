@@ -4,6 +4,7 @@
 #include "../../../../common.shared/loader_errors.h"
 
 #include "../../../core_dispatcher.h"
+#include "../../../cache/previews/PreviewCache.h"
 #include "../../../controls/CommonStyle.h"
 #include "../../../controls/TextEmojiWidget.h"
 #include "../../../gui_settings.h"
@@ -14,7 +15,6 @@
 #include "../../../themes/ThemePixmap.h"
 #include "../../../utils/InterConnector.h"
 #include "../../../utils/LoadMovieFromFileTask.h"
-#include "../../../utils/LoadPixmapFromFileTask.h"
 #include "../../../utils/log/log.h"
 #include "../../../utils/PainterPath.h"
 #include "../../../utils/utils.h"
@@ -738,7 +738,7 @@ void FileSharingBlock::drawPreview(QPainter &p, const QRect &previewRect, QPaint
 
                 if (videoplayer_->state() == QMovie::MovieState::Paused)
                 {
-                    p.drawPixmap(previewRect, videoplayer_->getActiveImage());
+                    p.drawImage(previewRect, videoplayer_->getActiveImage());
                 }
             }
         }
@@ -1336,7 +1336,51 @@ void FileSharingBlock::requestPreview(const QString &uri)
     assert(isPreviewable());
     assert(PreviewRequestId_ == -1);
 
-    PreviewRequestId_ = GetDispatcher()->downloadImage(uri, getChatAimid(), QString(), false, 0, 0);
+    PreviewUri_ = uri;
+
+    auto cache = Logic::GetPreviewCache();
+
+    const auto previewSize = Style::Preview::getImageDecodeSizeMax();
+
+    Logic::PreviewCacheEntry entry;
+    if (cache->Find(uri, previewSize, Out entry))
+    {
+        Preview_ = entry.Preview_;
+
+        update();
+
+        return;
+    }
+
+    const auto isLoading = cache->Load(
+        uri,
+        previewSize,
+        this,
+        [this, uri]
+        (const Logic::PreviewCacheEntry &loaded)
+        {
+            if (loaded.Preview_.isNull())
+            {
+                downloadPreview(uri);
+                return;
+            }
+
+            Preview_ = loaded.Preview_;
+
+            update();
+        });
+
+    if (!isLoading)
+    {
+        downloadPreview(uri);
+    }
+}
+
+void FileSharingBlock::downloadPreview(const QString &uri)
+{
+    assert(PreviewRequestId_ == -1);
+
+    PreviewRequestId_ = GetDispatcher()->downloadImage(uri, getChatAimid(), QString(), false, 0, 0, false, Style::Preview::getImageDecodeSizeMax(), this);
 }
 
 void FileSharingBlock::sendGenericMetainfoRequests()
@@ -1508,6 +1552,14 @@ void FileSharingBlock::onImageDownloaded(int64_t seq, QString uri, QPixmap image
     Preview_ = image;
 
     update();
+
+    if (!PreviewUri_.isEmpty())
+    {
+        Logic::PreviewCacheEntry entry;
+        entry.Preview_ = image;
+
+        Logic::GetPreviewCache()->Put(PreviewUri_, Style::Preview::getImageDecodeSizeMax(), entry);
+    }
 }
 
 void FileSharingBlock::onImageDownloadingProgress(qint64 seq, int64_t bytesTotal, int64_t bytesTransferred, int32_t pctTransferred)
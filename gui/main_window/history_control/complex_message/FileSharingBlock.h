@@ -159,6 +159,8 @@ private:
 
     void playMedia(const QString &localPath);
 
+    void downloadPreview(const QString &uri);
+
     void requestPreview(const QString &uri);
 
     void requestSnapMetainfo();
@@ -203,6 +205,8 @@ private:
 
     int64_t PreviewRequestId_;
 
+    QString PreviewUri_;
+
     ActionButtonWidget *CtrlButton_;
 
     Themes::IThemePixmapSptr SnapExpiredImage_;
@@ -13,6 +13,7 @@
 #include "../../../gui_settings.h"
 #include "../../../controls/TextEditEx.h"
 #include "../../../theme_settings.h"
+#include "../../../cache/previews/PreviewCache.h"
 #include "../../../cache/themes/themes.h"
 
 #include "../ActionButtonWidget.h"
@@ -393,7 +394,7 @@ void ImagePreviewBlock::drawBlock(QPainter &p, const QRect& _rect, const QColor&
 
                 if (videoPlayer_->state() == QMovie::MovieState::Paused && videoPlayer_->isGif())
                 {
-                    p.drawPixmap(imageRect, videoPlayer_->getActiveImage());
+                    p.drawImage(imageRect, videoPlayer_->getActiveImage());
                 }
             }
         }
@@ -440,14 +441,12 @@ void ImagePreviewBlock::initialize()
 
     requestSnapMetainfo();
 
-    assert(PreviewDownloadSeq_ == -1);
-    PreviewDownloadSeq_ = Ui::GetDispatcher()->downloadImage(
-        ImageUri_,
-        getChatAimid(),
-        QString(),
-        true,
-        Style::Preview::getImageWidthMax(),
-        0);
+    if (loadCachedPreview())
+    {
+        return;
+    }
+
+    requestPreview();
 }
 
 void ImagePreviewBlock::mouseMoveEvent(QMouseEvent *event)
@@ -971,6 +970,46 @@ void ImagePreviewBlock::onLeftMouseClick(const QPoint &globalPos)
     downloadFullImage(QString());
 }
 
+bool ImagePreviewBlock::loadCachedPreview()
+{
+    auto cache = Logic::GetPreviewCache();
+
+    const auto previewSize = Style::Preview::getImageDecodeSizeMax();
+
+    Logic::PreviewCacheEntry entry;
+    if (cache->Find(ImageUri_, previewSize, Out entry))
+    {
+        onCachedPreviewLoaded(entry);
+        return true;
+    }
+
+    return cache->Load(
+        ImageUri_,
+        previewSize,
+        this,
+        [this]
+        (const Logic::PreviewCacheEntry &loaded)
+        {
+            if (loaded.Preview_.isNull())
+            {
+                requestPreview();
+                return;
+            }
+
+            onCachedPreviewLoaded(loaded);
+        });
+}
+
+void ImagePreviewBlock::onCachedPreviewLoaded(const Logic::PreviewCacheEntry &entry)
+{
+    assert(!entry.Preview_.isNull());
+
+    DownloadUri_ = entry.DownloadUri_;
+    FileSize_ = entry.FileSize_;
+
+    onPreviewImageDownloaded(entry.Preview_, entry.LocalPath_);
+}
+
 void ImagePreviewBlock::onPreviewImageDownloaded(QPixmap image, const QString &localPath)
 {
     assert(!image.isNull());
@@ -989,6 +1028,21 @@ void ImagePreviewBlock::onPreviewImageDownloaded(QPixmap image, const QString &l
     preloadFullImageIfNeeded();
 }
 
+void ImagePreviewBlock::requestPreview()
+{
+    assert(PreviewDownloadSeq_ == -1);
+    PreviewDownloadSeq_ = Ui::GetDispatcher()->downloadImage(
+        ImageUri_,
+        getChatAimid(),
+        QString(),
+        true,
+        Style::Preview::getImageWidthMax(),
+        0,
+        false,
+        Style::Preview::getImageDecodeSizeMax(),
+        this);
+}
+
 void ImagePreviewBlock::openPreviewer(QPixmap /*image*/, const QString &localPath)
 {
     assert(!localPath.isEmpty());
@@ -1244,6 +1298,14 @@ void ImagePreviewBlock::onImageDownloaded(int64_t seq, QString, QPixmap image, Q
 
         PreviewDownloadSeq_ = -1;
 
+        Logic::PreviewCacheEntry entry;
+        entry.Preview_ = image;
+        entry.DownloadUri_ = DownloadUri_;
+        entry.FileSize_ = FileSize_;
+        entry.LocalPath_ = localPath;
+
+        Logic::GetPreviewCache()->Put(ImageUri_, Style::Preview::getImageDecodeSizeMax(), entry);
+
         return;
     }
 
@@ -11,6 +11,11 @@ class ActionButtonWidget;
 class TextEditEx;
 UI_NS_END
 
+namespace Logic
+{
+    struct PreviewCacheEntry;
+}
+
 UI_COMPLEX_MESSAGE_NS_BEGIN
 
 class ImagePreviewBlockLayout;
@@ -127,6 +132,10 @@ private:
 
     bool isVideoPreview() const;
 
+    bool loadCachedPreview();
+
+    void onCachedPreviewLoaded(const Logic::PreviewCacheEntry &entry);
+
     void onFullImageDownloaded(QPixmap image, const QString &localPath);
 
     void onGifLeftMouseClick();
@@ -145,6 +154,8 @@ private:
 
     void preloadFullImageIfNeeded();
 
+    void requestPreview();
+
     void requestSnapMetainfo();
 
     void schedulePreviewerOpening(const QPoint &globalPos);
@@ -1,9 +1,11 @@
 #include "stdafx.h"
 
+#include "../../../cache/previews/PreviewCache.h"
 #include "../../../cache/themes/themes.h"
 #include "../../../core_dispatcher.h"
 #include "../../../controls/TextEditEx.h"
 #include "../../../fonts.h"
+#include "../../../utils/ImageDecodePool.h"
 #include "../../../utils/InterConnector.h"
 #include "../../../utils/log/log.h"
 #include "../../../utils/profiling/auto_stop_watch.h"
@@ -14,7 +16,6 @@
 
 #include "../ActionButtonWidget.h"
 #include "../MessageStyle.h"
-#include "../ResizePixmapTask.h"
 
 #include "ComplexMessageItem.h"
 #include "FileSharingUtils.h"
@@ -870,6 +871,24 @@ TextEditEx* LinkPreviewBlock::createTextEditControl(const QString &text, const Q
     return textControl;
 }
 
+void LinkPreviewBlock::decodeScaledPreview(const QPixmap &image, const QSize &scaledSize)
+{
+    Utils::GetImageDecodePool()->decode(
+        QString(),
+        Utils::DecodePriority::NearViewport,
+        this,
+        Utils::makeResizeDecoder(image, scaledSize),
+        [this, scaledSize](QPixmap scaled)
+        {
+            setPreviewImage(scaled);
+
+            Logic::PreviewCacheEntry entry;
+            entry.Preview_ = scaled;
+
+            Logic::GetPreviewCache()->Put(Uri_, scaledSize, entry);
+        });
+}
+
 void LinkPreviewBlock::drawFavicon(QPainter &p)
 {
     if (FavIcon_.isNull())
@@ -1058,36 +1077,42 @@ void LinkPreviewBlock::scalePreview(QPixmap &image)
     const auto shouldScalePreviewDown = (previewSize != scaledPreviewSize);
     if (!shouldScalePreviewDown)
     {
-        PreviewImage_ = image;
-
-        Utils::check_pixel_ratio(PreviewImage_);
-
-        initializeActionButton();
+        setPreviewImage(image);
+        return;
+    }
 
-        notifyBlockContentsChanged();
+    // the same link is often shown in several messages, the downscaled image is taken from the cache then
+    auto cache = Logic::GetPreviewCache();
 
+    Logic::PreviewCacheEntry cached;
+    if (cache->Find(Uri_, scaledPreviewSize, Out cached))
+    {
+        setPreviewImage(cached.Preview_);
         return;
     }
 
-    auto task = new HistoryControl::ResizePixmapTask(image, scaledPreviewSize);
+    const QPixmap original = image;
 
-    const auto succeed = QObject::connect(
-        task,
-        &HistoryControl::ResizePixmapTask::resizedSignal,
+    const auto isOnDisk = cache->Load(
+        Uri_,
+        scaledPreviewSize,
         this,
-        [this](QPixmap scaled)
+        [this, original, scaledPreviewSize]
+        (const Logic::PreviewCacheEntry &loaded)
         {
-            PreviewImage_ = scaled;
-
-            Utils::check_pixel_ratio(PreviewImage_);
-
-            initializeActionButton();
+            if (loaded.Preview_.isNull())
+            {
+                decodeScaledPreview(original, scaledPreviewSize);
+                return;
+            }
 
-            notifyBlockContentsChanged();
+            setPreviewImage(loaded.Preview_);
         });
-    assert(succeed);
 
-    QThreadPool::globalInstance()->start(task);
+    if (!isOnDisk)
+    {
+        decodeScaledPreview(image, scaledPreviewSize);
+    }
 }
 
 QSize LinkPreviewBlock::scalePreviewSize(const QSize &size) const
@@ -1121,6 +1146,17 @@ QSize LinkPreviewBlock::scalePreviewSize(const QSize &size) const
     return result;
 }
 
+void LinkPreviewBlock::setPreviewImage(const QPixmap &image)
+{
+    PreviewImage_ = image;
+
+    Utils::check_pixel_ratio(PreviewImage_);
+
+    initializeActionButton();
+
+    notifyBlockContentsChanged();
+}
+
 void LinkPreviewBlock::updateRequestId()
 {
     const auto pendingDataExists = (!MetaDownloaded_ || !ImageDownloaded_ || !FaviconDownloaded_);
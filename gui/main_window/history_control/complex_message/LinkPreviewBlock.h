@@ -202,6 +202,8 @@ private:
 
     Ui::TextEditEx* createTextEditControl(const QString &text, const QFont &font, TextOptions options);
 
+    void decodeScaledPreview(const QPixmap &image, const QSize &scaledSize);
+
     void drawFavicon(QPainter &p);
 
     void drawPreloader(QPainter &p);
@@ -222,6 +224,8 @@ private:
 
     QSize scalePreviewSize(const QSize &size) const;
 
+    void setPreviewImage(const QPixmap &image);
+
     void updateRequestId();
 };
 
@@ -60,6 +60,12 @@ namespace Style
             return Utils::scale_value(388);
         }
 
+        QSize getImageDecodeSizeMax()
+        {
+            // the largest preview as it is drawn on the device pixels
+            return Utils::scale_bitmap(QSize(getImageWidthMax(), getImageHeightMax()));
+        }
+
         QBrush getImageShadeBrush()
         {
             QColor imageShadeColor("#000000");
@@ -18,6 +18,7 @@ namespace Style
     {
         int32_t getImageHeightMax();
         int32_t getImageWidthMax();
+        QSize getImageDecodeSizeMax();
         QBrush getImageShadeBrush();
         QSize getMinPreviewSize();
         QSizeF getMinPreviewSizeF();
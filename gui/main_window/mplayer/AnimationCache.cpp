@@ -0,0 +1,251 @@
+#include "stdafx.h"
+#include "AnimationCache.h"
+
+namespace
+{
+    const int64_t default_budget = 48 * 1024 * 1024;
+
+    const int64_t max_clip_bytes = 16 * 1024 * 1024;
+    const int64_t max_clip_duration_ms = 15000;
+
+    const int max_indexed_colors = 256;
+
+    // the image as Format_Indexed8 if it has no more than 256 colors, otherwise a null image
+    QImage toIndexed(const QImage& _image)
+    {
+        if (_image.format() != QImage::Format_RGB32 && _image.format() != QImage::Format_ARGB32)
+            return QImage();
+
+        QImage indexed(_image.size(), QImage::Format_Indexed8);
+        if (indexed.isNull())
+            return QImage();
+
+        // the alpha byte of Format_RGB32 is not defined, the color table holds it as opaque
+        const QRgb alphaMask = (_image.format() == QImage::Format_RGB32 ? 0xff000000 : 0);
+
+        QVector<QRgb> colors;
+        colors.reserve(max_indexed_colors);
+
+        QHash<QRgb, uchar> indexes;
+
+        QRgb lastColor = 0;
+        uchar lastIndex = 0;
+
+        for (int y = 0; y < _image.height(); ++y)
+        {
+            const auto src = reinterpret_cast<const QRgb*>(_image.constScanLine(y));
+            auto dst = indexed.scanLine(y);
+
+            for (int x = 0; x < _image.width(); ++x)
+            {
+                const QRgb color = (src[x] | alphaMask);
+
+                // neighbour pixels mostly share a color
+                if (colors.isEmpty() || color != lastColor)
+                {
+                    const auto iter = indexes.constFind(color);
+                    if (iter != indexes.constEnd())
+                    {
+                        lastIndex = iter.value();
+                    }
+                    else
+                    {
+                        if (colors.size() == max_indexed_colors)
+                            return QImage();
+
+                        lastIndex = (uchar) colors.size();
+
+                        indexes.insert(color, lastIndex);
+                        colors.push_back(color);
+                    }
+
+                    lastColor = color;
+                }
+
+                dst[x] = lastIndex;
+            }
+        }
+
+        indexed.setColorTable(colors);
+
+        return indexed;
+    }
+}
+
+namespace Ui
+{
+    //////////////////////////////////////////////////////////////////////////
+    // AnimationFrames
+    //////////////////////////////////////////////////////////////////////////
+    QImage AnimationFrame::toImage() const
+    {
+        if (image_.format() == QImage::Format_Indexed8)
+            return image_.convertToFormat(format_);
+
+        return image_;
+    }
+
+    void AnimationFrames::addFrame(const QImage& _image, const double _pts, const QSize& _shownSize)
+    {
+        QImage image = _image;
+
+        // the decoder scales with SWS_POINT as well, so the fast scaling keeps the look and the colors of the frame
+        if (!_shownSize.isEmpty() && (image.width() > _shownSize.width() || image.height() > _shownSize.height()))
+        {
+            image = image.scaled(_shownSize, Qt::KeepAspectRatio, Qt::FastTransformation);
+
+            fitSize_ = _shownSize;
+            isScaledDown_ = true;
+        }
+
+        const QImage indexed = toIndexed(image);
+        if (!indexed.isNull())
+            image = indexed;
+
+        frames_.emplace_back(image, _image.format(), _pts);
+
+        bytes_ += image.byteCount();
+    }
+
+    bool AnimationFrames::fits(const QSize& _shownSize) const
+    {
+        if (!isScaledDown_)
+            return true;
+
+        return (_shownSize.width() <= fitSize_.width() && _shownSize.height() <= fitSize_.height());
+    }
+
+    size_t AnimationFrames::findFrame(const double _pts) const
+    {
+        const auto iter = std::lower_bound(frames_.begin(), frames_.end(), _pts, [](const AnimationFrame& _frame, const double _value)
+        {
+            return _frame.pts_ < _value;
+        });
+
+        return (size_t) (iter - frames_.begin());
+    }
+
+
+    //////////////////////////////////////////////////////////////////////////
+    // AnimationCache
+    //////////////////////////////////////////////////////////////////////////
+    AnimationCache::AnimationCache()
+        : bytes_(0)
+        , budget_(default_budget)
+    {
+    }
+
+    bool AnimationCache::canCache(const int64_t _durationMs)
+    {
+        return (_durationMs > 0 && _durationMs <= max_clip_duration_ms);
+    }
+
+    bool AnimationCache::canCache(const AnimationFrames& _frames)
+    {
+        return (!_frames.frames_.empty() && _frames.bytes_ <= max_clip_bytes);
+    }
+
+    AnimationFramesCSptr AnimationCache::get(const QString& _path, const QSize& _shownSize)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        const auto iter = index_.find(_path);
+        if (iter == index_.end() || !iter->second->frames_->fits(_shownSize))
+            return AnimationFramesCSptr();
+
+        entries_.splice(entries_.begin(), entries_, iter->second);
+
+        return iter->second->frames_;
+    }
+
+    void AnimationCache::insert(const QString& _path, AnimationFramesCSptr _frames)
+    {
+        assert(_frames);
+
+        if (!_frames || !canCache(*_frames))
+            return;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        const auto iter = index_.find(_path);
+        if (iter != index_.end())
+        {
+            bytes_ -= iter->second->frames_->bytes_;
+
+            entries_.erase(iter->second);
+            index_.erase(iter);
+        }
+
+        Entry entry;
+        entry.path_ = _path;
+        entry.frames_ = _frames;
+
+        entries_.push_front(entry);
+        index_[_path] = entries_.begin();
+
+        bytes_ += _frames->bytes_;
+
+        shrink();
+    }
+
+    void AnimationCache::remove(const QString& _path)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        const auto iter = index_.find(_path);
+        if (iter == index_.end())
+            return;
+
+        bytes_ -= iter->second->frames_->bytes_;
+
+        entries_.erase(iter->second);
+        index_.erase(iter);
+    }
+
+    void AnimationCache::setBudget(const int64_t _bytes)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        budget_ = _bytes;
+
+        shrink();
+    }
+
+    int64_t AnimationCache::getBytes() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        return bytes_;
+    }
+
+    void AnimationCache::clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        entries_.clear();
+        index_.clear();
+
+        bytes_ = 0;
+    }
+
+    void AnimationCache::shrink()
+    {
+        while (bytes_ > budget_ && !entries_.empty())
+        {
+            const auto& last = entries_.back();
+
+            bytes_ -= last.frames_->bytes_;
+
+            index_.erase(last.path_);
+            entries_.pop_back();
+        }
+    }
+
+    // created on load, the decode threads may ask for it concurrently
+    AnimationCache g_animation_cache;
+
+    AnimationCache* getAnimationCache()
+    {
+        return &g_animation_cache;
+    }
+}
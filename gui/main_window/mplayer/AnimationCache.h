@@ -0,0 +1,92 @@
+#pragma once
+
+namespace Ui
+{
+    //////////////////////////////////////////////////////////////////////////
+    // AnimationFrames
+    //////////////////////////////////////////////////////////////////////////
+    struct AnimationFrame
+    {
+        // a frame of up to 256 colors (a gif frame) is kept indexed, one byte a pixel
+        QImage image_;
+
+        // the format the frame is painted in
+        QImage::Format format_;
+
+        double pts_;
+
+        AnimationFrame(const QImage& _image, const QImage::Format _format, const double _pts) : image_(_image), format_(_format), pts_(_pts) {}
+
+        QImage toImage() const;
+    };
+
+    struct AnimationFrames
+    {
+        std::vector<AnimationFrame> frames_;
+
+        int64_t bytes_;
+
+        // the frames were scaled down to fit this size, they are not shown in a larger player
+        QSize fitSize_;
+        bool isScaledDown_;
+
+        AnimationFrames() : bytes_(0), isScaledDown_(false) {}
+
+        // the frame is scaled down to the shown size first
+        void addFrame(const QImage& _image, const double _pts, const QSize& _shownSize);
+
+        bool fits(const QSize& _shownSize) const;
+
+        // index of the first frame shown at or after _pts
+        size_t findFrame(const double _pts) const;
+    };
+
+    typedef std::shared_ptr<AnimationFrames> AnimationFramesSptr;
+    typedef std::shared_ptr<const AnimationFrames> AnimationFramesCSptr;
+
+    //////////////////////////////////////////////////////////////////////////
+    // AnimationCache
+    // keeps the decoded frames of short silent clips (gifs, animated stickers),
+    // so a clip shown again is played without demuxing and decoding
+    //////////////////////////////////////////////////////////////////////////
+    class AnimationCache
+    {
+        struct Entry
+        {
+            QString path_;
+
+            AnimationFramesCSptr frames_;
+        };
+
+        mutable std::mutex mutex_;
+
+        // most recently used first
+        std::list<Entry> entries_;
+
+        std::map<QString, std::list<Entry>::iterator> index_;
+
+        int64_t bytes_;
+        int64_t budget_;
+
+        void shrink();
+
+    public:
+
+        AnimationCache();
+
+        static bool canCache(const int64_t _durationMs);
+        static bool canCache(const AnimationFrames& _frames);
+
+        AnimationFramesCSptr get(const QString& _path, const QSize& _shownSize);
+
+        void insert(const QString& _path, AnimationFramesCSptr _frames);
+        void remove(const QString& _path);
+
+        void setBudget(const int64_t _bytes);
+        int64_t getBytes() const;
+
+        void clear();
+    };
+
+    AnimationCache* getAnimationCache();
+}
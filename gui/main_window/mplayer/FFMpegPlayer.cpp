@@ -5,6 +5,7 @@
 
 #include "../../utils/PainterPath.h"
 #include "../history_control/MessageStyle.h"
+#include "../../utils/log/log.h"
 
 #include "../sounds/SoundsManager.h"
 
@@ -24,6 +25,18 @@ namespace Ui
     const int max_video_w = 1280;
     const int max_video_h = 720;
 
+    const int32_t frame_line_align = 32;
+    const int32_t max_pooled_frames = 4;
+
+    // a frame behind the audio clock by more than this is never shown
+    const double max_frame_lateness = 0.1;
+    const int32_t max_dropped_frames_in_row = 5;
+
+    // decoding of all players is spread over this many threads at most
+    const int32_t max_video_decode_threads = 4;
+
+    const int32_t offscreen_poll_interval = 500;
+
     bool ThreadMessagesQueue::getMessage(ThreadMessage& _message, std::function<bool()> _isQuit, int32_t _wait_timeout)
     { 
         condition_.tryAcquire(1, _wait_timeout);
@@ -172,8 +185,13 @@ namespace Ui
         , startTimeAudio_(0)
         , startTimeVideoSet_(false)
         , startTimeAudioSet_(false)
-        , frameRGB_(0)
         , swsContext_(0)
+        , framePool_(std::make_shared<VideoFramePool>())
+        , frameFormat_(QImage::Format_RGB32)
+        , framesDecoded_(0)
+        , framesDropped_(0)
+        , playsFromCache_(false)
+        , cachedFrameIndex_(0)
         , volume_(100)
         , mute_(true)
         , audioQuitRecv_(false)
@@ -187,6 +205,107 @@ namespace Ui
     }
 
 
+    //////////////////////////////////////////////////////////////////////////
+    // VideoFramePool
+    //////////////////////////////////////////////////////////////////////////
+    VideoFramePool::VideoFramePool()
+        : bytesPerLine_(0)
+        , generation_(0)
+    {
+    }
+
+    VideoFramePool::~VideoFramePool()
+    {
+        clear();
+    }
+
+    QImage VideoFramePool::getFrame(const QSize& _size, QImage::Format _format)
+    {
+        uint8_t* data = nullptr;
+        int32_t generation = 0;
+        int32_t bytesPerLine = 0;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            if (_size != size_)
+            {
+                for (auto buffer : freeBuffers_)
+                    ffmpeg::av_free(buffer);
+
+                freeBuffers_.clear();
+
+                size_ = _size;
+                bytesPerLine_ = FFALIGN(_size.width() * 4, frame_line_align);
+
+                ++generation_;
+            }
+
+            if (!freeBuffers_.empty())
+            {
+                data = freeBuffers_.back();
+                freeBuffers_.pop_back();
+            }
+
+            generation = generation_;
+            bytesPerLine = bytesPerLine_;
+        }
+
+        if (!data)
+            data = (uint8_t*) ffmpeg::av_malloc(bytesPerLine * _size.height());
+
+        if (!data)
+            return QImage();
+
+        auto ref = new BufferRef();
+        ref->pool_ = shared_from_this();
+        ref->data_ = data;
+        ref->generation_ = generation;
+
+        return QImage(data, _size.width(), _size.height(), bytesPerLine, _format, &VideoFramePool::releaseBuffer, ref);
+    }
+
+    void VideoFramePool::releaseBuffer(void* _ref)
+    {
+        std::unique_ptr<BufferRef> ref((BufferRef*) _ref);
+
+        if (auto pool = ref->pool_.lock())
+            pool->recycle(ref->data_, ref->generation_);
+        else
+            ffmpeg::av_free(ref->data_);
+    }
+
+    void VideoFramePool::recycle(uint8_t* _data, int32_t _generation)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            if (_generation == generation_ && (int32_t) freeBuffers_.size() < max_pooled_frames)
+            {
+                freeBuffers_.push_back(_data);
+
+                return;
+            }
+        }
+
+        ffmpeg::av_free(_data);
+    }
+
+    void VideoFramePool::clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        for (auto buffer : freeBuffers_)
+            ffmpeg::av_free(buffer);
+
+        freeBuffers_.clear();
+
+        size_ = QSize();
+
+        ++generation_;
+    }
+
+
     //////////////////////////////////////////////////////////////////////////
     // VideoContext
     //////////////////////////////////////////////////////////////////////////
@@ -194,6 +313,10 @@ namespace Ui
         : quit_(false)
         , curr_id_(0)
     {
+        const int32_t threadsCount = std::max(1, std::min(QThread::idealThreadCount() / 2, max_video_decode_threads));
+
+        for (int32_t i = 0; i < threadsCount; ++i)
+            videoThreadMessagesQueues_.emplace_back(new ThreadMessagesQueue());
     }
 
     void VideoContext::init(MediaData& _media)
@@ -246,6 +369,8 @@ namespace Ui
             activeVideos_.erase(_videoId);
         }
 
+        releaseVideoThreadIndex(_videoId);
+
         getMediaContainer()->stopMedia(_videoId);
     }
 
@@ -474,6 +599,50 @@ namespace Ui
         _queue.push(pkt);
     }
 
+    void VideoContext::getNextCachedVideoFrame(VideoData& _videoData, MediaData& _media, uint32_t _videoId)
+    {
+        // the demux thread still handles seeks, so only the flush packets are of interest here
+        ffmpeg::AVPacket packet;
+
+        while (_media.videoQueue_->get(packet))
+        {
+            if (packet.data == (uint8_t*) &flush_pkt_data)
+            {
+                if (packet.dts != -1)
+                {
+                    _media.cachedFrameIndex_ = _media.cachedFrames_->findFrame(packet.dts * getVideoTimebase(_media));
+
+                    emit seekedV(_videoId);
+                }
+            }
+            else if (packet.data && packet.data != (uint8_t*) &quit_pkt)
+            {
+                ffmpeg::av_packet_unref(&packet);
+            }
+        }
+
+        const auto& frames = _media.cachedFrames_->frames_;
+
+        if (_media.cachedFrameIndex_ < frames.size())
+        {
+            const auto& frame = frames[_media.cachedFrameIndex_++];
+
+            _media.videoClock_ = frame.pts_;
+
+            emit nextframeReady(_videoId, frame.toImage(), frame.pts_, false);
+
+            return;
+        }
+
+        _media.cachedFrameIndex_ = 0;
+
+        _videoData.current_state_ = decode_thread_state::dts_end_of_media;
+
+        resetVideoClock(_media);
+
+        emit nextframeReady(_videoId, QImage(), 0, true);
+    }
+
     void VideoContext::pushVideoPacket(ffmpeg::AVPacket* _packet, MediaData& _media)
     {
         if (!_packet)
@@ -522,6 +691,8 @@ namespace Ui
             return false;
         }
 
+        _media.path_ = _file;
+
         // Retrieve stream information
         err = ffmpeg::avformat_find_stream_info(_media.formatContext_, 0);
         if (err < 0)
@@ -701,6 +872,17 @@ namespace Ui
         return actual_delay;
     }
 
+    bool VideoContext::isFrameLate(double _picturePts, MediaData& _media) const
+    {
+        if (!_media.syncWithAudio_ || !_media.audioClockTime_)
+            return false;
+
+        int64_t timeDiff = ffmpeg::av_gettime() - _media.audioClockTime_;
+        double pts_audio = _media.audioClock_ + ((double) timeDiff) / (double) 1000000.0;
+
+        return (pts_audio - _picturePts > max_frame_lateness);
+    }
+
     bool VideoContext::initDecodeAudioData(MediaData& _media)
     {
         if (!enableAudio(_media))
@@ -1123,9 +1305,61 @@ namespace Ui
         postVideoThreadMessage(msg, false);
     }
 
+    int32_t VideoContext::getVideoThreadIndex(uint32_t _videoId)
+    {
+        std::unique_lock<std::mutex> lock(videoThreadsMutex_);
+
+        auto iter = videoThreads_.find(_videoId);
+        if (iter != videoThreads_.end())
+            return iter->second;
+
+        // a media already deleted (or never added) gets no thread, otherwise nothing would release it
+        {
+            std::unique_lock<std::mutex> activeLock(activeVideosMutex_);
+            if (activeVideos_.count(_videoId) == 0)
+                return -1;
+        }
+
+        // new media goes to the thread with the least media on it
+        std::vector<int32_t> load(videoThreadMessagesQueues_.size(), 0);
+
+        for (const auto& thread : videoThreads_)
+            ++load[thread.second];
+
+        const int32_t index = (int32_t) (std::min_element(load.begin(), load.end()) - load.begin());
+
+        videoThreads_[_videoId] = index;
+
+        return index;
+    }
+
+    void VideoContext::releaseVideoThreadIndex(uint32_t _videoId)
+    {
+        std::unique_lock<std::mutex> lock(videoThreadsMutex_);
+
+        videoThreads_.erase(_videoId);
+    }
+
+    int32_t VideoContext::getVideoThreadsCount() const
+    {
+        return (int32_t) videoThreadMessagesQueues_.size();
+    }
+
     void VideoContext::postVideoThreadMessage(const ThreadMessage& _message, bool _forward, bool _clear_others)
     {
-        videoThreadMessagesQueue_.pushMessage(_message, _forward, _clear_others);
+        if (_message.message_ == thread_message_type::tmt_wake_up)
+        {
+            for (auto& queue : videoThreadMessagesQueues_)
+                queue->pushMessage(_message, _forward, _clear_others);
+
+            return;
+        }
+
+        const auto index = getVideoThreadIndex(_message.videoId_);
+        if (index < 0)
+            return;
+
+        videoThreadMessagesQueues_[index]->pushMessage(_message, _forward, _clear_others);
     }
 
     void VideoContext::postDemuxThreadMessage(const ThreadMessage& _message, bool _forward, bool _clear_others)
@@ -1150,7 +1384,9 @@ namespace Ui
 
     void VideoContext::clearMessageQueue()
     {
-        videoThreadMessagesQueue_.clear();
+        for (auto& queue : videoThreadMessagesQueues_)
+            queue->clear();
+
         audioThreadMessageQueue_.clear();
         demuxThreadMessageQueue_.clear();
     }
@@ -1165,9 +1401,9 @@ namespace Ui
         _media.audioData_.state_ = _state;
     }
 
-    bool VideoContext::getVideoThreadMessage(ThreadMessage& _message, int32_t _waitTimeout)
+    bool VideoContext::getVideoThreadMessage(ThreadMessage& _message, int32_t _threadIndex, int32_t _waitTimeout)
     {
-        return videoThreadMessagesQueue_.getMessage(_message, [this]{return isQuit();}, _waitTimeout);
+        return videoThreadMessagesQueues_[_threadIndex]->getMessage(_message, [this]{return isQuit();}, _waitTimeout);
     }
 
     bool VideoContext::updateScaleContext(MediaData& _media, const QSize _sz)
@@ -1186,13 +1422,7 @@ namespace Ui
 
     void VideoContext::freeScaleContext(MediaData& _media)
     {
-        if (_media.frameRGB_)
-        {
-            ffmpeg::av_frame_unref(_media.frameRGB_);
-            ffmpeg::av_frame_free(&_media.frameRGB_);
-        }
-
-        _media.frameRGB_ = 0;
+        _media.framePool_->clear();
     }
 
     bool VideoContext::enableAudio(MediaData& _media) const
@@ -1666,6 +1896,11 @@ namespace Ui
                     elem.second.eof = eof;
                 }
 
+                if (media.playsFromCache_)
+                {
+                    continue;
+                }
+
                 if (
                         (
                             (ctx_.getAudioQueueSize(media) > maxQueueSize || !ctx_.enableAudio(media))
@@ -1742,8 +1977,9 @@ namespace Ui
     //////////////////////////////////////////////////////////////////////////
     // VideoDecodeThread
     //////////////////////////////////////////////////////////////////////////
-    VideoDecodeThread::VideoDecodeThread(VideoContext& _ctx)
+    VideoDecodeThread::VideoDecodeThread(VideoContext& _ctx, int32_t _index)
         :   ctx_(_ctx)
+        ,   index_(_index)
     {
 
     }
@@ -1755,6 +1991,17 @@ namespace Ui
 
 
         ctx_.updateScaleContext(_media, QSize(w, h));
+
+        if (_media.isImage_ || ctx_.enableAudio(_media) || !AnimationCache::canCache(ctx_.getDuration(_media)))
+            return;
+
+        _media.cachedFrames_ = getAnimationCache()->get(_media.path_, Utils::scale_bitmap(ctx_.getScaledSize(_media)));
+        _media.cachedFrameIndex_ = 0;
+
+        if (_media.cachedFrames_)
+            _media.playsFromCache_ = true;
+        else
+            _media.recordedFrames_ = std::make_shared<AnimationFrames>();
     }
 
     void VideoDecodeThread::run()
@@ -1771,7 +2018,7 @@ namespace Ui
 
         while (!ctx_.isQuit())
         {
-            if (ctx_.getVideoThreadMessage(msg, waitMsgTimeout))
+            if (ctx_.getVideoThreadMessage(msg, index_, waitMsgTimeout))
             {
                 auto videoId = msg.videoId_;
                 bool success = false;
@@ -1868,6 +2115,12 @@ namespace Ui
                             videoData[videoId].current_state_ = dts_playing;
                         }
 
+                        // a clip seeked in the middle of the first pass can't be cached
+                        if (media.recordedFrames_ && !media.recordedFrames_->frames_.empty())
+                        {
+                            media.recordedFrames_.reset();
+                        }
+
                         break;
                     }
                     case thread_message_type::tmt_get_next_video_frame:
@@ -1881,6 +2134,13 @@ namespace Ui
                             break;
                         }
 
+                        if (media.cachedFrames_)
+                        {
+                            ctx_.getNextCachedVideoFrame(videoData[videoId], media, videoId);
+
+                            break;
+                        }
+
                         ffmpeg::av_frame_unref(frame);
 
                         videoData[videoId].eof_ = false;
@@ -1909,6 +2169,23 @@ namespace Ui
                                 break;
                             }
 
+                            ++media.framesDecoded_;
+
+                            // the player would never show this frame, so don't spend time converting it
+                            if (videoData[videoId].droppedInRow_ < max_dropped_frames_in_row && ctx_.isFrameLate(pts, media))
+                            {
+                                ++videoData[videoId].droppedInRow_;
+                                ++media.framesDropped_;
+
+                                ffmpeg::av_frame_unref(frame);
+
+                                ctx_.postVideoThreadMessage(ThreadMessage(videoId, thread_message_type::tmt_get_next_video_frame), true);
+
+                                break;
+                            }
+
+                            videoData[videoId].droppedInRow_ = 0;
+
                             QSize scaledSize(frame->width, frame->height);
 
                             if (frame->width < frame->height)
@@ -1923,46 +2200,35 @@ namespace Ui
                             // update scale context
                             if ((media.needUpdateSwsContext_) || (frame->format != -1 && frame->format != media.codecContext_->pix_fmt) || !media.swsContext_)
                             {
-                                if (media.frameRGB_)
-                                {
-                                    ffmpeg::av_frame_unref(media.frameRGB_);
-                                    ffmpeg::av_frame_free(&media.frameRGB_);
-
-                                    media.frameRGB_ = 0;
-                                }
-
                                 media.needUpdateSwsContext_ = false;
+
+                                // AV_PIX_FMT_RGB32 has the memory layout of QImage::Format_(A)RGB32, so frames can be painted without conversion
                                 media.swsContext_ = sws_getCachedContext(
                                     media.swsContext_, 
                                     frame->width, 
                                     frame->height, 
-                                    ffmpeg::AVPixelFormat(frame->format), scaledSize.width(), scaledSize.height(), ffmpeg::AV_PIX_FMT_RGBA, SWS_POINT, 0, 0, 0);
-                                
-                                int align = 256;
-                                while (1)
-                                {
-                                    if (frame->linesize[0] % align == 0)
-                                        break;
-                                    
-                                    align = align / 2;
-                                }
-
-                                media.frameRGB_ = ffmpeg::av_frame_alloc();
-                                int numBytes = ffmpeg::av_image_get_buffer_size(ffmpeg::AV_PIX_FMT_RGBA, scaledSize.width(), scaledSize.height(), align);
-                                media.scaledBuffer_.resize(numBytes);
-                                av_image_fill_arrays(media.frameRGB_->data, media.frameRGB_->linesize, &media.scaledBuffer_[0], ffmpeg::AV_PIX_FMT_RGBA, scaledSize.width(), scaledSize.height(), align);
+                                    ffmpeg::AVPixelFormat(frame->format), scaledSize.width(), scaledSize.height(), ffmpeg::AV_PIX_FMT_RGB32, SWS_POINT, 0, 0, 0);
 
-                            }
+                                const ffmpeg::AVPixFmtDescriptor* desc = ffmpeg::av_pix_fmt_desc_get(ffmpeg::AVPixelFormat(frame->format));
+
+                                const bool hasAlpha = (!desc || (desc->flags & (AV_PIX_FMT_FLAG_ALPHA | AV_PIX_FMT_FLAG_PAL)));
 
-                            ffmpeg::sws_scale(media.swsContext_, frame->data, frame->linesize, 0, frame->height, media.frameRGB_->data, media.frameRGB_->linesize);
+                                media.frameFormat_ = (hasAlpha ? QImage::Format_ARGB32 : QImage::Format_RGB32);
+                            }
 
-                            QImage lastFrame(scaledSize.width(), scaledSize.height(), QImage::Format_RGBA8888);
+                            // sws_scale writes straight into the pooled buffer the renderer will paint from
+                            QImage lastFrame = media.framePool_->getFrame(scaledSize, media.frameFormat_);
 
-                            for (int32_t y = 0; y < scaledSize.height(); ++y)
+                            if (lastFrame.isNull())
                             {
-                                memcpy(lastFrame.scanLine(y), media.frameRGB_->data[0] + y*media.frameRGB_->linesize[0], scaledSize.width()*4);
+                                break;
                             }
 
+                            uint8_t* dstData[4] = { lastFrame.bits(), 0, 0, 0 };
+                            int dstLinesize[4] = { lastFrame.bytesPerLine(), 0, 0, 0 };
+
+                            ffmpeg::sws_scale(media.swsContext_, frame->data, frame->linesize, 0, frame->height, dstData, dstLinesize);
+
                             std::unique_ptr<QTransform> imageTransform;
 
                             if (ctx_.getRotation(media))
@@ -1976,6 +2242,14 @@ namespace Ui
                                 lastFrame = lastFrame.transformed(*imageTransform);
                             }
 
+                            if (media.recordedFrames_)
+                            {
+                                media.recordedFrames_->addFrame(lastFrame, pts, Utils::scale_bitmap(ctx_.getScaledSize(media)));
+
+                                if (!AnimationCache::canCache(*media.recordedFrames_))
+                                    media.recordedFrames_.reset();
+                            }
+
                             emit ctx_.nextframeReady(videoId, lastFrame, pts, false);
                         }
                         else if (videoData[videoId].eof_)
@@ -1989,6 +2263,18 @@ namespace Ui
 
                             ctx_.resetVideoClock(media);
 
+                            if (media.recordedFrames_)
+                            {
+                                getAnimationCache()->insert(media.path_, media.recordedFrames_);
+
+                                // next loops are played from the recorded frames too
+                                media.cachedFrames_ = media.recordedFrames_;
+                                media.cachedFrameIndex_ = 0;
+                                media.playsFromCache_ = true;
+
+                                media.recordedFrames_.reset();
+                            }
+
                             emit ctx_.nextframeReady(videoId, QImage(), 0, true);
                         }
                         else
@@ -2319,21 +2605,26 @@ namespace Ui
         auto t2 = std::chrono::system_clock::now();
 
         if (fillClient_)
-            _painter.drawPixmap(drawRect, activeImage_, sourceRect);
+            _painter.drawImage(drawRect, activeImage_, sourceRect);
         else
-            _painter.drawPixmap(drawRect, activeImage_);
+            _painter.drawImage(drawRect, activeImage_);
 
         //auto t3 = std::chrono::system_clock::now();
 
         //qDebug() << "fill time " << (t2 - t1)/std::chrono::milliseconds(1) << "draw frame time " << (t3 - t2)/std::chrono::milliseconds(1);
     }
 
-    void FrameRenderer::updateFrame(QPixmap _image)
+    void FrameRenderer::updateFrame(QImage _image)
     {
         activeImage_ = _image;
     }
 
-    QPixmap FrameRenderer::getActiveImage() const
+    void FrameRenderer::updateFrame(QPixmap _image)
+    {
+        activeImage_ = _image.toImage();
+    }
+
+    QImage FrameRenderer::getActiveImage() const
     {
         return activeImage_;
     }
@@ -2518,6 +2809,7 @@ namespace Ui
         :   QWidget(_parent),
             state_(decode_thread_state::dts_none),
             isFirstFrame_(true),
+            offscreen_(false),
             lastVideoPosition_(0),
             lastPostedPosition_(0),
             lastEmitMouseMove_(std::chrono::system_clock::now() - mouse_move_rate),
@@ -2630,13 +2922,11 @@ namespace Ui
 
         if (!_eof)
         {
-            QPixmap frame = QPixmap::fromImage(QImage(_image));
-
-            decodedFrames_.emplace_back(frame, _pts);
+            decodedFrames_.emplace_back(_image, _pts);
 
             if (!firstFrame_)
             {
-                firstFrame_.reset(new DecodedFrame(frame, _pts));
+                firstFrame_.reset(new DecodedFrame(_image, _pts));
 
                 emit firstFrameReady();
             }
@@ -2731,6 +3021,12 @@ namespace Ui
         if (!continius_)
             stoped_ = true;
 
+        bool success = false;
+        auto media = getMediaContainer()->ctx_.getMediaData(mediaId_, success);
+
+        if (success)
+            collectFrameStats(*media);
+
         getMediaContainer()->ctx_.setVideoQuit(mediaId_);
 
         getMediaContainer()->postDemuxThreadMessage(ThreadMessage(mediaId_, thread_message_type::tmt_quit), true, true);
@@ -2815,6 +3111,24 @@ namespace Ui
             return;
         }
 
+        // silent players scrolled out of sight stop pulling frames and leave the decode threads to the visible ones
+        if (!getMediaContainer()->ctx_.enableAudio(*media) && !active_renderer_->isActiveImageNull() && !isOnScreen())
+        {
+            offscreen_ = true;
+
+            if (getStarted())
+                timer_->start(offscreen_poll_interval);
+
+            return;
+        }
+
+        if (offscreen_)
+        {
+            offscreen_ = false;
+
+            getMediaContainer()->resetFrameTimer(*media);
+        }
+
         if (decodedFrames_.empty())
         {
             if (getStarted())
@@ -2893,6 +3207,8 @@ namespace Ui
 
         active_renderer_->updateFrame(frame.image_);
 
+        ++frameStats_.displayed_;
+
         if (!success)
         {
             timer_->stop();
@@ -3254,11 +3570,47 @@ namespace Ui
         active_renderer_->redraw();
     }
 
-    QPixmap FFMpegPlayer::getActiveImage() const
+    QImage FFMpegPlayer::getActiveImage() const
     {
         return active_renderer_->getActiveImage();
     }
 
+    void FFMpegPlayer::collectFrameStats(MediaData& _media)
+    {
+        frameStats_.decoded_ += _media.framesDecoded_.exchange(0);
+        frameStats_.dropped_ += _media.framesDropped_.exchange(0);
+
+        __TRACE(
+            "mplayer",
+            "frame stats\n" <<
+            __LOGP(decoded, frameStats_.decoded_) <<
+            __LOGP(dropped, frameStats_.dropped_) <<
+            __LOGP(displayed, frameStats_.displayed_));
+    }
+
+    bool FFMpegPlayer::isOnScreen() const
+    {
+        const QWidget* widget = active_renderer_->getWidget();
+
+        return (widget->isVisible() && !widget->window()->isMinimized() && !widget->visibleRegion().isEmpty());
+    }
+
+    VideoFrameStats FFMpegPlayer::getFrameStats() const
+    {
+        VideoFrameStats stats = frameStats_;
+
+        bool success = false;
+        auto media = getMediaContainer()->ctx_.getMediaData(mediaId_, success);
+
+        if (success)
+        {
+            stats.decoded_ += media->framesDecoded_;
+            stats.dropped_ += media->framesDropped_;
+        }
+
+        return stats;
+    }
+
     bool FFMpegPlayer::getStarted() const
     {
         return started_;
@@ -3474,12 +3826,14 @@ namespace Ui
     }
 
     MediaContainer::MediaContainer()
-        : videoDecodeThread_(ctx_)
-        , audioDecodeThread_(ctx_)
+        : audioDecodeThread_(ctx_)
         , demuxThread_(ctx_)
         , is_demux_inited_(false)
         , is_decods_inited_(false)
-    {}
+    {
+        for (int32_t i = 0; i < ctx_.getVideoThreadsCount(); ++i)
+            videoDecodeThreads_.emplace_back(new VideoDecodeThread(ctx_, i));
+    }
 
     MediaContainer::~MediaContainer()
     {
@@ -3501,7 +3855,8 @@ namespace Ui
 
     void MediaContainer::VideoDecodeThreadStart(uint32_t _mediaId)
     {
-        videoDecodeThread_.start();
+        for (auto& thread : videoDecodeThreads_)
+            thread->start();
     }
 
     void MediaContainer::AudioDecodeThreadStart(uint32_t _mediaId)
@@ -3673,7 +4028,8 @@ namespace Ui
 
     void MediaContainer::VideoDecodeThreadWait()
     {
-        videoDecodeThread_.wait();
+        for (auto& thread : videoDecodeThreads_)
+            thread->wait();
     }
 
     void MediaContainer::AudioDecodeThreadWait()
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ffmpeg.h"
+#include "AnimationCache.h"
 
 namespace Ui
 {
@@ -173,6 +174,51 @@ namespace Ui
         }
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // VideoFramePool
+    //////////////////////////////////////////////////////////////////////////
+    class VideoFramePool : public std::enable_shared_from_this<VideoFramePool>
+    {
+        struct BufferRef
+        {
+            std::weak_ptr<VideoFramePool> pool_;
+            uint8_t* data_;
+            int32_t generation_;
+        };
+
+        std::mutex mutex_;
+
+        std::vector<uint8_t*> freeBuffers_;
+
+        QSize size_;
+        int32_t bytesPerLine_;
+        int32_t generation_;
+
+        static void releaseBuffer(void* _ref);
+
+        void recycle(uint8_t* _data, int32_t _generation);
+
+    public:
+
+        VideoFramePool();
+        ~VideoFramePool();
+
+        // returns an image backed by a pooled buffer, the buffer goes back to the pool
+        // when the last copy of the image is destroyed
+        QImage getFrame(const QSize& _size, QImage::Format _format);
+
+        void clear();
+    };
+
+    struct VideoFrameStats
+    {
+        int64_t decoded_;
+        int64_t dropped_;
+        int64_t displayed_;
+
+        VideoFrameStats() : decoded_(0), dropped_(0), displayed_(0) {}
+    };
+
     struct MediaData 
     {
         bool syncWithAudio_;
@@ -187,10 +233,23 @@ namespace Ui
 
         bool needUpdateSwsContext_;
         ffmpeg::SwsContext* swsContext_;
-        std::vector<uint8_t> scaledBuffer_;
-        ffmpeg::AVFrame* frameRGB_;
+        std::shared_ptr<VideoFramePool> framePool_;
+        QImage::Format frameFormat_;
         DecodeAudioData audioData_;
 
+        std::atomic<int64_t> framesDecoded_;
+        std::atomic<int64_t> framesDropped_;
+
+        QString path_;
+
+        // set when the clip is played from the animation cache, the demux thread then reads no packets
+        std::atomic<bool> playsFromCache_;
+        AnimationFramesCSptr cachedFrames_;
+        size_t cachedFrameIndex_;
+
+        // frames of a short clip collected on the first pass for the animation cache
+        AnimationFramesSptr recordedFrames_;
+
         std::map<int32_t, QImage> frames_;
 
         int32_t width_;
@@ -234,8 +293,9 @@ namespace Ui
         decode_thread_state current_state_;
         bool eof_;
         bool stream_finished_;
+        int32_t droppedInRow_;
 
-        VideoData() : eof_(false), stream_finished_(false), current_state_(dts_none) {}
+        VideoData() : eof_(false), stream_finished_(false), droppedInRow_(0), current_state_(dts_none) {}
     };
 
     struct AudioData
@@ -287,7 +347,11 @@ namespace Ui
         mutable std::unordered_map<uint32_t, bool> activeVideos_;
         mutable std::mutex activeVideosMutex_;
 
-        ThreadMessagesQueue videoThreadMessagesQueue_;
+        // one queue per video decode thread, every media sticks to one thread
+        std::vector<std::unique_ptr<ThreadMessagesQueue>> videoThreadMessagesQueues_;
+
+        std::unordered_map<uint32_t, int32_t> videoThreads_;
+        std::mutex videoThreadsMutex_;
         ThreadMessagesQueue demuxThreadMessageQueue_;
         ThreadMessagesQueue audioThreadMessageQueue_;
 
@@ -297,6 +361,9 @@ namespace Ui
         void closeStream(ffmpeg::AVStream* _stream);
         void SendCloseStreams(uint32_t _videoId);
 
+        int32_t getVideoThreadIndex(uint32_t _videoId);
+        void releaseVideoThreadIndex(uint32_t _videoId);
+
     public:
 
         VideoContext();
@@ -317,6 +384,7 @@ namespace Ui
         bool isStreamError(MediaData& _media);
 
         bool getNextVideoFrame(/*OUT*/ffmpeg::AVFrame* _frame, ffmpeg::AVPacket* _packet, VideoData& _videoData, MediaData& _media, uint32_t _videoId);
+        void getNextCachedVideoFrame(VideoData& _videoData, MediaData& _media, uint32_t _videoId);
 
         void pushVideoPacket(ffmpeg::AVPacket* _packet, MediaData& _media);
         int32_t getVideoQueuePackets(MediaData& _media) const;
@@ -348,6 +416,7 @@ namespace Ui
         double getAudioTimebase(MediaData& _media);
         double synchronizeVideo(ffmpeg::AVFrame* _frame, double _pts, MediaData& _media);
         double computeDelay(double _picturePts, MediaData& _media);
+        bool isFrameLate(double _picturePts, MediaData& _media) const;
 
         bool initDecodeAudioData(MediaData& _media);
         void freeDecodeAudioData(MediaData& _media);
@@ -377,7 +446,8 @@ namespace Ui
         void updateScaledVideoSize(uint32_t _videoId, const QSize& _sz);
 
         void postVideoThreadMessage(const ThreadMessage& _message, bool _forward, bool _clear_others = false);
-        bool getVideoThreadMessage(ThreadMessage& _message, int32_t _waitTimeout);
+        bool getVideoThreadMessage(ThreadMessage& _message, int32_t _threadIndex, int32_t _waitTimeout);
+        int32_t getVideoThreadsCount() const;
 
         void postDemuxThreadMessage(const ThreadMessage& _message, bool _forward, bool _clear_others = false);
         bool getDemuxThreadMessage(ThreadMessage& _message, int32_t _waitTimeout);
@@ -445,13 +515,15 @@ namespace Ui
 
         VideoContext& ctx_;
 
+        const int32_t index_;
+
     protected:
 
         virtual void run() override;
 
     public:
 
-        VideoDecodeThread(VideoContext& _ctx);
+        VideoDecodeThread(VideoContext& _ctx, int32_t _index);
 
         void prepareCtx(MediaData& _media);
     };
@@ -476,7 +548,7 @@ namespace Ui
 
     class FrameRenderer
     {
-        QPixmap activeImage_;
+        QImage activeImage_;
         QColor fillColor_;
 
         std::function<void(const QSize _sz)> sizeCallback_;
@@ -495,8 +567,9 @@ namespace Ui
 
     public:
 
+        void updateFrame(QImage _image);
         void updateFrame(QPixmap _image);
-        QPixmap getActiveImage() const;
+        QImage getActiveImage() const;
 
         bool isActiveImageNull() const;
 
@@ -616,7 +689,7 @@ namespace Ui
         std::unordered_set<uint32_t> active_video_ids_;
 
         DemuxThread demuxThread_;
-        VideoDecodeThread videoDecodeThread_;
+        std::vector<std::unique_ptr<VideoDecodeThread>> videoDecodeThreads_;
         AudioDecodeThread audioDecodeThread_;
 
         void DemuxThreadWait();
@@ -652,17 +725,19 @@ namespace Ui
 
         bool isFirstFrame_;
 
+        bool offscreen_;
+
         int updatePositonRate_;
 
         struct DecodedFrame
         {
-            QPixmap image_;
+            QImage image_;
 
             double pts_;
 
             bool eof_;
 
-            DecodedFrame(const QPixmap& _image, const double _pts) : image_(_image), pts_(_pts), eof_(false) {}
+            DecodedFrame(const QImage& _image, const double _pts) : image_(_image), pts_(_pts), eof_(false) {}
             DecodedFrame(const bool& _eof) : eof_(_eof) {}
         };
 
@@ -670,6 +745,12 @@ namespace Ui
 
         std::list<DecodedFrame> decodedFrames_;
 
+        VideoFrameStats frameStats_;
+
+        void collectFrameStats(MediaData& _media);
+
+        bool isOnScreen() const;
+
         double computeDelay();
 
         decode_thread_state state_;
@@ -777,7 +858,9 @@ namespace Ui
         void setNormal();
 
         void setPreview(QPixmap _preview);
-        QPixmap getActiveImage() const;
+        QImage getActiveImage() const;
+
+        VideoFrameStats getFrameStats() const;
 
         bool getStarted() const;
         void setStarted(bool _started);
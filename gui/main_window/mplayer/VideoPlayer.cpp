@@ -1085,7 +1085,7 @@ namespace Ui
         ffplayer_->setPreview(_preview);
     }
 
-    QPixmap DialogPlayer::getActiveImage() const
+    QImage DialogPlayer::getActiveImage() const
     {
         return ffplayer_->getActiveImage();
     }
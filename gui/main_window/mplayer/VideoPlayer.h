@@ -191,7 +191,7 @@ namespace Ui
         bool inited();
 
         void setPreview(QPixmap _preview);
-        QPixmap getActiveImage() const;
+        QImage getActiveImage() const;
 
         void setLoadingState(bool _isLoad);
 
@@ -12,8 +12,8 @@ namespace Themes
 namespace Emoji
 {
     struct EmojiRecord;
-    typedef std::shared_ptr<EmojiRecord> EmojiRecordSptr;
-    typedef std::vector<EmojiRecordSptr> EmojiRecordSptrVec;
+    typedef const EmojiRecord* EmojiRecordPtr;
+    typedef std::vector<EmojiRecordPtr> EmojiRecordPtrVec;
 }
 
 namespace Ui
@@ -36,9 +36,9 @@ namespace Ui
         struct emoji_category
         {
             QString									name_;
-            const Emoji::EmojiRecordSptrVec&		emojis_;
+            const Emoji::EmojiRecordPtrVec&		emojis_;
 
-            emoji_category(const QString& _name, const Emoji::EmojiRecordSptrVec& _emojis)
+            emoji_category(const QString& _name, const Emoji::EmojiRecordPtrVec& _emojis)
                 :	name_(_name), emojis_(_emojis)
             {
             }
@@ -73,7 +73,7 @@ namespace Ui
             int spacing() const;
             void setSpacing(int _spacing);
 
-            Emoji::EmojiRecordSptr getEmoji(int _col, int _row) const;
+            Emoji::EmojiRecordPtr getEmoji(int _col, int _row) const;
 
         };
 
@@ -117,7 +117,7 @@ namespace Ui
             int addCategory(const emoji_category& _category);
             int getCategoryPos(int _index);
             const std::vector<emoji_category>& getCategories() const;
-            Emoji::EmojiRecordSptr getEmoji(int _col, int _row) const;
+            Emoji::EmojiRecordPtr getEmoji(int _col, int _row) const;
             void onEmojiAdded();
 
         };
@@ -135,7 +135,7 @@ namespace Ui
 
         Q_SIGNALS:
 
-            void emojiSelected(Emoji::EmojiRecordSptr _emoji);
+            void emojiSelected(Emoji::EmojiRecordPtr _emoji);
             void scrollToGroup(const int _pos);
 
         public:
@@ -154,14 +154,14 @@ namespace Ui
         {
         Q_OBJECT
         Q_SIGNALS:
-            void emojiSelected(Emoji::EmojiRecordSptr _emoji);
+            void emojiSelected(Emoji::EmojiRecordPtr _emoji);
             void stickerSelected(qint32 _setId, qint32 _stickerId);
 
         private Q_SLOTS:
             void stickers_event();
 
         private:
-            Emoji::EmojiRecordSptrVec emojis_;
+            Emoji::EmojiRecordPtrVec emojis_;
 
             QVBoxLayout* vLayout_;
             EmojiTableView* emojiView_;
@@ -175,7 +175,7 @@ namespace Ui
             ~RecentsWidget();
 
             void addSticker(int32_t _set_id, int32_t _stickerOd);
-            void addEmoji(Emoji::EmojiRecordSptr _emoji);
+            void addEmoji(Emoji::EmojiRecordPtr _emoji);
             void initEmojisFromSettings();
             void initStickersFromSettings();
             void onStickerUpdated(int32_t _setOd, int32_t _stickerOd);
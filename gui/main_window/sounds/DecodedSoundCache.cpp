@@ -0,0 +1,107 @@
+#include "stdafx.h"
+#include "DecodedSoundCache.h"
+
+namespace
+{
+    QString makeKey(const QString& _file)
+    {
+        assert(!_file.isEmpty());
+
+        // the resources never change
+        if (_file.startsWith(':'))
+        {
+            return _file;
+        }
+
+        const QFileInfo info(_file);
+
+        return QString("%1|%2|%3")
+            .arg(info.absoluteFilePath())
+            .arg(info.size())
+            .arg(info.lastModified().toMSecsSinceEpoch());
+    }
+}
+
+namespace Ui
+{
+    DecodedSound::DecodedSound()
+        : Frequency_(0)
+        , Format_(0)
+    {
+    }
+
+    DecodedSoundCache::Entry::Entry(const QString& _key, const DecodedSound& _sound)
+        : Key_(_key)
+        , Sound_(_sound)
+    {
+    }
+
+    DecodedSoundCache::DecodedSoundCache(const int64_t _budgetBytes)
+        : Bytes_(0)
+        , Budget_(_budgetBytes)
+    {
+        assert(Budget_ > 0);
+    }
+
+    bool DecodedSoundCache::find(const QString& _file, Out DecodedSound& _sound)
+    {
+        auto iter = Index_.find(makeKey(_file));
+        if (iter == Index_.end())
+        {
+            return false;
+        }
+
+        Lru_.splice(Lru_.begin(), Lru_, iter.value());
+
+        _sound = iter.value()->Sound_;
+
+        return true;
+    }
+
+    void DecodedSoundCache::put(const QString& _file, const DecodedSound& _sound)
+    {
+        if (_sound.Data_.isEmpty() || (_sound.Data_.size() > (Budget_ / 4)))
+        {
+            return;
+        }
+
+        const auto key = makeKey(_file);
+
+        auto iter = Index_.find(key);
+        if (iter != Index_.end())
+        {
+            Bytes_ -= iter.value()->Sound_.Data_.size();
+
+            Lru_.erase(iter.value());
+            Index_.erase(iter);
+        }
+
+        Lru_.emplace_front(key, _sound);
+        Index_.insert(key, Lru_.begin());
+
+        Bytes_ += _sound.Data_.size();
+
+        shrink();
+    }
+
+    void DecodedSoundCache::clear()
+    {
+        Index_.clear();
+        Lru_.clear();
+
+        Bytes_ = 0;
+    }
+
+    void DecodedSoundCache::shrink()
+    {
+        while ((Bytes_ > Budget_) && (Lru_.size() > 1))
+        {
+            const auto &victim = Lru_.back();
+
+            Bytes_ -= victim.Sound_.Data_.size();
+
+            Index_.remove(victim.Key_);
+            Lru_.pop_back();
+        }
+    }
+}
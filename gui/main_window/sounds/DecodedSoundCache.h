@@ -0,0 +1,52 @@
+#pragma once
+
+namespace Ui
+{
+    struct DecodedSound
+    {
+        DecodedSound();
+
+        QByteArray Data_;
+
+        qint64 Frequency_;
+
+        qint64 Format_;
+    };
+
+    // the sounds decoded lately kept as pcm so that playing them again takes no decoding;
+    // a file is looked up by its path, the size and the modification time of a local file are a part of the key
+    class DecodedSoundCache
+    {
+    public:
+        explicit DecodedSoundCache(const int64_t _budgetBytes);
+
+        bool find(const QString& _file, Out DecodedSound& _sound);
+
+        // the sounds larger than a quarter of the budget are not kept
+        void put(const QString& _file, const DecodedSound& _sound);
+
+        void clear();
+
+    private:
+        struct Entry
+        {
+            Entry(const QString& _key, const DecodedSound& _sound);
+
+            const QString Key_;
+
+            DecodedSound Sound_;
+        };
+
+        typedef std::list<Entry> EntryList;
+
+        void shrink();
+
+        EntryList Lru_;
+
+        QHash<QString, EntryList::iterator> Index_;
+
+        int64_t Bytes_;
+
+        const int64_t Budget_;
+    };
+}
@@ -17,6 +17,43 @@ const int IncomingMessageInterval = 3000;
 const int PttCheckInterval = 100;
 const int DeviceCheckInterval = 60 * 1000;
 
+const int64_t DecodedSoundsBudget = 32 * 1024 * 1024;
+
+// the clips longer than this are played while decoded, the decoding keeps this far ahead of the playback
+const int StreamMinDurationSec = 20;
+const int StreamLeadMsec = 2000;
+
+namespace
+{
+    void readAll(Ui::MpegLoader& loader, Ui::DecodedSound& sound)
+    {
+        qint64 samplesAdded = 0;
+
+        sound.Frequency_ = loader.frequency();
+        sound.Format_ = loader.format();
+
+        while (loader.readMore(sound.Data_, samplesAdded) >= 0)
+        {
+        }
+    }
+
+    qint64 bufferSamples(openal::ALuint buffer)
+    {
+        openal::ALint sizeInBytes = 0;
+        openal::ALint channels = 0;
+        openal::ALint bits = 0;
+
+        openal::alGetBufferi(buffer, AL_SIZE, &sizeInBytes);
+        openal::alGetBufferi(buffer, AL_CHANNELS, &channels);
+        openal::alGetBufferi(buffer, AL_BITS, &bits);
+
+        if (channels <= 0 || bits <= 0)
+            return 0;
+
+        return (qint64)sizeInBytes * 8 / (channels * bits);
+    }
+}
+
 namespace Ui
 {
     void PlayingData::init()
@@ -65,6 +102,15 @@ namespace Ui
             openal::alSourcei(Source_, AL_BUFFER, 0);
             openal::alDeleteBuffers(1, &Buffer_);
         }
+
+        if (!StreamBuffers_.empty())
+        {
+            openal::alSourcei(Source_, AL_BUFFER, 0);
+            openal::alDeleteBuffers((openal::ALsizei)StreamBuffers_.size(), StreamBuffers_.data());
+            StreamBuffers_.clear();
+        }
+
+        Stream_.reset();
     }
 
     void PlayingData::clear()
@@ -72,6 +118,12 @@ namespace Ui
         Buffer_ = 0;
         Source_ = 0;
         Id_ = -1;
+
+        Stream_.reset();
+        StreamBuffers_.clear();
+        StreamSamples_ = 0;
+        StreamPlayedSamples_ = 0;
+        StreamDuration_ = 0;
     }
     
     void PlayingData::free()
@@ -98,6 +150,9 @@ namespace Ui
 
     int PlayingData::calcDuration()
     {
+        if (StreamDuration_ > 0)
+            return StreamDuration_;
+
         openal::ALint sizeInBytes;
         openal::ALint channels;
         openal::ALint bits;
@@ -122,6 +177,93 @@ namespace Ui
         return state;
     }
 
+    void PlayingData::setStream(const std::shared_ptr<MpegLoader>& loader)
+    {
+        assert(loader);
+        assert(loader->frequency() > 0);
+
+        Stream_ = loader;
+        StreamSamples_ = 0;
+        StreamPlayedSamples_ = 0;
+        StreamDuration_ = (int)(loader->duration() * 1000 / loader->frequency());
+    }
+
+    bool PlayingData::isStreaming() const
+    {
+        return !!Stream_;
+    }
+
+    bool PlayingData::feedStream(int leadMsec)
+    {
+        if (!Stream_)
+            return false;
+
+        // the played buffers are unqueued, AL_SAMPLE_OFFSET then counts from the first buffer still queued;
+        // when the decoding fell behind and the source ran dry, all the buffers are played and the offset is 0
+        openal::ALint processed = 0;
+        openal::alGetSourcei(Source_, AL_BUFFERS_PROCESSED, &processed);
+
+        if (processed > 0)
+        {
+            std::vector<openal::ALuint> played(processed);
+            openal::alSourceUnqueueBuffers(Source_, processed, played.data());
+
+            for (auto buffer : played)
+            {
+                StreamPlayedSamples_ += bufferSamples(buffer);
+                StreamBuffers_.erase(std::remove(StreamBuffers_.begin(), StreamBuffers_.end(), buffer), StreamBuffers_.end());
+            }
+
+            openal::alDeleteBuffers(processed, played.data());
+        }
+
+        openal::ALint offset = 0;
+        openal::alGetSourcei(Source_, AL_SAMPLE_OFFSET, &offset);
+
+        const auto playedSamples = StreamPlayedSamples_ + offset;
+
+        const qint64 frequency = Stream_->frequency();
+
+        auto isQueued = false;
+
+        while (Stream_ && ((StreamSamples_ - playedSamples) * 1000 / frequency) < leadMsec)
+        {
+            QByteArray data;
+            qint64 samplesAdded = 0;
+
+            // a buffer holds about a quarter of a second
+            auto isEnd = false;
+            while (samplesAdded < (frequency / 4))
+            {
+                if (Stream_->readMore(data, samplesAdded) < 0)
+                {
+                    isEnd = true;
+                    break;
+                }
+            }
+
+            if (!data.isEmpty())
+            {
+                openal::ALuint buffer = 0;
+                openal::alGenBuffers(1, &buffer);
+                openal::alBufferData(buffer, Stream_->format(), data.constData(), data.size(), frequency);
+                openal::alSourceQueueBuffers(Source_, 1, &buffer);
+
+                StreamBuffers_.push_back(buffer);
+                StreamSamples_ += samplesAdded;
+
+                isQueued = true;
+            }
+
+            if (isEnd)
+            {
+                Stream_.reset();
+            }
+        }
+
+        return isQueued;
+    }
+
 	SoundsManager::SoundsManager()
 		: QObject(0)
 		, CallInProgress_(false)
@@ -133,6 +275,7 @@ namespace Ui
         , AlAudioDevice_(0)
         , AlAudioContext_(0)
         , AlInited_(false)
+        , SoundCache_(DecodedSoundsBudget)
 	{
         initIncomig();
         initOutgoing();
@@ -187,6 +330,7 @@ namespace Ui
             openal::alGetSourcei(CurPlay_.Source_, AL_SOURCE_STATE, &state);
             if (state == AL_PLAYING || state == AL_INITIAL)
             {
+                CurPlay_.feedStream(StreamLeadMsec);
                 PttTimer_->start();
             }
             else if (state == AL_PAUSED)
@@ -195,6 +339,13 @@ namespace Ui
             }
             else if (state == AL_STOPPED)
             {
+                if (CurPlay_.feedStream(StreamLeadMsec))
+                {
+                    sourcePlay(CurPlay_.Source_);
+                    PttTimer_->start();
+                    return;
+                }
+
                 emit pttFinished(CurPlay_.Id_, true);
                 if (!PrevPlay_.isEmpty())
                 {
@@ -326,20 +477,28 @@ namespace Ui
 
         CurPlay_.init();
 
-        MpegLoader l(file, false);
-        if (!l.open())
-            return -1;
-
-        QByteArray result;
-        qint64 samplesAdded = 0, frequency = l.frequency(), format = l.format();
-        while (1) 
+        DecodedSound sound;
+        if (!SoundCache_.find(file, sound))
         {
-            int res = l.readMore(result, samplesAdded);
-            if (res < 0)
-                break;
-        }     
+            auto loader = std::make_shared<MpegLoader>(file, false);
+            if (!loader->open())
+                return -1;
 
-        CurPlay_.setBuffer(result, frequency, format);
+            const auto isLong = (loader->duration() > ((qint64)loader->frequency() * StreamMinDurationSec));
+            if (isLong)
+            {
+                CurPlay_.setStream(loader);
+                CurPlay_.feedStream(StreamLeadMsec);
+            }
+            else
+            {
+                readAll(*loader, sound);
+                SoundCache_.put(file, sound);
+            }
+        }
+
+        if (!sound.Data_.isEmpty())
+            CurPlay_.setBuffer(sound.Data_, sound.Frequency_, sound.Format_);
         
         CurPlay_.Id_ = ++AlId;
         duration = CurPlay_.play();
@@ -401,97 +560,47 @@ namespace Ui
     
     void SoundsManager::initIncomig()
     {
-        if (!AlInited_)
-            initOpenAl();
-
-        if (!Incoming_.isEmpty())
-            return;
-        
-        Incoming_.init();
-        
-        MpegLoader l(build::is_icq() ? ":/sounds/incoming" : ":/sounds/incoming_agent", true);
-        if (!l.open())
-            return;
-        
-        QByteArray result;
-        qint64 samplesAdded = 0, frequency = l.frequency(), format = l.format();
-        while (1)
-        {
-            int res = l.readMore(result, samplesAdded);
-            if (res < 0)
-                break;
-        }
-        
-        Incoming_.setBuffer(result, frequency, format);
-        
-        int err;
-        if ((err = openal::alGetError()) == AL_NO_ERROR)
-        {
-            Incoming_.Id_ = ++AlId;
-        }
+        initSound(Incoming_, build::is_icq() ? ":/sounds/incoming" : ":/sounds/incoming_agent");
     }
 
     void SoundsManager::initMail()
+    {
+        initSound(Mail_, ":/sounds/mail");
+    }
+
+    void SoundsManager::initOutgoing()
+    {
+        initSound(Outgoing_, ":/sounds/outgoing");
+    }
+
+    void SoundsManager::initSound(PlayingData& sound, const QString& file)
     {
         if (!AlInited_)
             initOpenAl();
 
-        if (!Mail_.isEmpty())
+        if (!sound.isEmpty())
             return;
 
-        Mail_.init();
+        sound.init();
 
-        MpegLoader l(":/sounds/mail", true);
-        if (!l.open())
-            return;
-
-        QByteArray result;
-        qint64 samplesAdded = 0, frequency = l.frequency(), format = l.format();
-        while (1)
+        // the decoded samples outlive the device, a reinit only uploads them again
+        DecodedSound decoded;
+        if (!SoundCache_.find(file, decoded))
         {
-            int res = l.readMore(result, samplesAdded);
-            if (res < 0)
-                break;
-        }
+            MpegLoader l(file, true);
+            if (!l.open())
+                return;
 
-        Mail_.setBuffer(result, frequency, format);
-
-        int err;
-        if ((err = openal::alGetError()) == AL_NO_ERROR)
-        {
-            Mail_.Id_ = ++AlId;
+            readAll(l, decoded);
+            SoundCache_.put(file, decoded);
         }
-    }
-    
-    void SoundsManager::initOutgoing()
-    {
-        if (!AlInited_)
-            initOpenAl();
 
-        if (!Outgoing_.isEmpty())
-            return;
-        
-        Outgoing_.init();
-        
-        MpegLoader l(":/sounds/outgoing", true);
-        if (!l.open())
-            return;
-        
-        QByteArray result;
-        qint64 samplesAdded = 0, frequency = l.frequency(), format = l.format();
-        while (1)
-        {
-            int res = l.readMore(result, samplesAdded);
-            if (res < 0)
-                break;
-        }
-        
-        Outgoing_.setBuffer(result, frequency, format);
-        
+        sound.setBuffer(decoded.Data_, decoded.Frequency_, decoded.Format_);
+
         int err;
         if ((err = openal::alGetError()) == AL_NO_ERROR)
         {
-            Outgoing_.Id_ = ++AlId;
+            sound.Id_ = ++AlId;
         }
     }
 
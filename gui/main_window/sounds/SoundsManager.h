@@ -1,13 +1,20 @@
 #pragma once
 
+#include "DecodedSoundCache.h"
+
 namespace Ui
 {
+    class MpegLoader;
+
     struct PlayingData
     {
         PlayingData()
             : Source_(0)
             , Buffer_(0)
             , Id_(-1)
+            , StreamSamples_(0)
+            , StreamPlayedSamples_(0)
+            , StreamDuration_(0)
         {
         }
 
@@ -23,9 +30,21 @@ namespace Ui
         int calcDuration();
         openal::ALenum state() const;
 
+        // a long clip is played while it is decoded, the decoded part is queued in buffers
+        void setStream(const std::shared_ptr<MpegLoader>& loader);
+        bool isStreaming() const;
+        bool feedStream(int leadMsec);
+
         openal::ALuint Source_;
         openal::ALuint Buffer_;
         int Id_;
+
+        std::shared_ptr<MpegLoader> Stream_;
+        std::vector<openal::ALuint> StreamBuffers_;
+        // the samples queued since the start and the samples of the buffers already played and unqueued
+        qint64 StreamSamples_;
+        qint64 StreamPlayedSamples_;
+        int StreamDuration_;
     };
 
 	class SoundsManager : public QObject
@@ -68,6 +87,8 @@ Q_SIGNALS:
         void updateDeviceTimer();
 
 	private:
+        void initSound(PlayingData& sound, const QString& file);
+
 		bool CallInProgress_;
 		bool CanPlayIncoming_;
 
@@ -85,6 +106,8 @@ Q_SIGNALS:
         QTimer* Timer_;
         QTimer* PttTimer_;
         QTimer* DeviceTimer_;
+
+        DecodedSoundCache SoundCache_;
 	};
 
 	SoundsManager* GetSoundsManager();
@@ -0,0 +1,392 @@
+#include "stdafx.h"
+
+#include "../../corelib/collection_helper.h"
+
+#include "utils.h"
+#include "../cache/previews/PreviewDiskCache.h"
+
+#include "ImageDecodePool.h"
+
+namespace
+{
+    class DecodeTask : public QRunnable
+    {
+    public:
+        DecodeTask(Utils::ImageDecodePool* _pool, const quint64 _jobId, const Utils::ImageDecoder& _decoder)
+            : Pool_(_pool)
+            , JobId_(_jobId)
+            , Decoder_(_decoder)
+        {
+            assert(Pool_);
+            assert(Decoder_);
+        }
+
+        void run()
+        {
+            const auto pixmap = Decoder_();
+
+            QMetaObject::invokeMethod(Pool_, "onDecoded", Qt::QueuedConnection, Q_ARG(quint64, JobId_), Q_ARG(QPixmap, pixmap));
+        }
+
+    private:
+        Utils::ImageDecodePool* Pool_;
+
+        const quint64 JobId_;
+
+        const Utils::ImageDecoder Decoder_;
+    };
+
+    QPixmap loadScaled(const QString& _cachePath, const QSize& _maxSize, const std::function<bool(Out QImage&)>& _load)
+    {
+        QImage preview;
+        if (!_cachePath.isEmpty() && Logic::LoadCachedPreview(_cachePath, _maxSize, Out preview))
+        {
+            return QPixmap::fromImage(preview);
+        }
+
+        if (!_load(Out preview))
+        {
+            return QPixmap();
+        }
+
+        if (!_cachePath.isEmpty())
+        {
+            Logic::SaveCachedPreview(_cachePath, _maxSize, preview);
+        }
+
+        return QPixmap::fromImage(preview);
+    }
+
+    bool isOnScreen(const QObject* _owner)
+    {
+        if (!_owner || !_owner->isWidgetType())
+        {
+            return false;
+        }
+
+        const auto widget = static_cast<const QWidget*>(_owner);
+
+        return (widget->isVisible() && !widget->visibleRegion().isEmpty());
+    }
+}
+
+namespace Utils
+{
+    ImageDecoder makeFileDecoder(const QString& _path, const QSize& _maxSize)
+    {
+        assert(!_path.isEmpty());
+
+        return [_path, _maxSize]
+        {
+            if (!QFile::exists(_path))
+            {
+                return QPixmap();
+            }
+
+            if (_maxSize.isValid())
+            {
+                return loadScaled(_path, _maxSize, [&_path, &_maxSize](Out QImage& _preview)
+                {
+                    return Utils::loadImageScaled(_path, _maxSize, Out _preview);
+                });
+            }
+
+            QPixmap preview;
+            Utils::loadPixmap(_path, Out preview);
+
+            return preview;
+        };
+    }
+
+    ImageDecoder makeDataDecoder(core::istream* _stream, const QSize& _maxSize, const QString& _localPath)
+    {
+        assert(_stream);
+
+        _stream->addref();
+
+        std::shared_ptr<core::istream> stream(_stream, [](core::istream* _released) { _released->release(); });
+
+        return [stream, _maxSize, _localPath]
+        {
+            const auto size = stream->size();
+            assert(size > 0);
+
+            // the stream is held until the decoder is gone, its buffer is not copied
+            const auto data = QByteArray::fromRawData((const char *)stream->read(size), (int)size);
+
+            if (_maxSize.isValid())
+            {
+                return loadScaled(_localPath, _maxSize, [&data, &_maxSize](Out QImage& _preview)
+                {
+                    return Utils::loadImageScaled(data, _maxSize, Out _preview);
+                });
+            }
+
+            QPixmap preview;
+            Utils::loadPixmap(data, Out preview);
+
+            return preview;
+        };
+    }
+
+    ImageDecoder makeResizeDecoder(const QPixmap& _pixmap, const QSize& _size)
+    {
+        assert(!_pixmap.isNull());
+        assert(!_size.isEmpty());
+
+        return [_pixmap, _size]
+        {
+            return _pixmap.scaled(_size, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+        };
+    }
+
+    ImageDecodePool::Job::Job()
+        : Priority_(DecodePriority::Prefetch)
+        , IsRunning_(false)
+    {
+    }
+
+    ImageDecodePool::ImageDecodePool()
+        : NextJobId_(0)
+        , RunningCount_(0)
+        , MaxRunningCount_(std::max(2, QThread::idealThreadCount() / 2))
+    {
+        Pool_.setMaxThreadCount(MaxRunningCount_);
+    }
+
+    ImageDecodePool::~ImageDecodePool()
+    {
+        Pool_.clear();
+        Pool_.waitForDone();
+    }
+
+    void ImageDecodePool::decode(const QString& _key, const DecodePriority _priority, QObject* _owner, const ImageDecoder& _decoder, const ImageConsumer& _consumer)
+    {
+        assert(_decoder);
+        assert(_consumer);
+
+        Consumer consumer;
+        consumer.Owner_ = _owner;
+        consumer.OwnerGuard_ = _owner;
+        consumer.Consume_ = _consumer;
+
+        addOwner(_owner);
+
+        const auto iterShared = (_key.isEmpty() ? JobsByKey_.end() : JobsByKey_.find(_key));
+        if (iterShared != JobsByKey_.end())
+        {
+            auto &job = Jobs_[iterShared.value()];
+
+            job.Priority_ = std::min(job.Priority_, _priority);
+            job.Consumers_.push_back(consumer);
+
+            return;
+        }
+
+        const auto jobId = ++NextJobId_;
+
+        auto &job = Jobs_[jobId];
+        job.Key_ = _key;
+        job.Priority_ = _priority;
+        job.Decoder_ = _decoder;
+        job.Consumers_.push_back(consumer);
+
+        if (!_key.isEmpty())
+        {
+            JobsByKey_.insert(_key, jobId);
+        }
+
+        startJobs();
+    }
+
+    void ImageDecodePool::cancel(QObject* _owner)
+    {
+        assert(_owner);
+
+        for (auto iter = Jobs_.begin(); iter != Jobs_.end();)
+        {
+            auto &consumers = iter->second.Consumers_;
+
+            const auto isOwned = [_owner](const Consumer& _consumer) { return (_consumer.Owner_ == _owner); };
+
+            consumers.erase(std::remove_if(consumers.begin(), consumers.end(), isOwned), consumers.end());
+
+            // the result of a running decode nobody waits for is thrown away once it is ready
+            if (consumers.empty() && !iter->second.IsRunning_)
+            {
+                dropJob(iter++);
+                continue;
+            }
+
+            ++iter;
+        }
+
+        if (Owners_.remove(_owner) > 0)
+        {
+            QObject::disconnect(_owner, &QObject::destroyed, this, &ImageDecodePool::onOwnerDestroyed);
+        }
+    }
+
+    void ImageDecodePool::onDecoded(quint64 _jobId, QPixmap _pixmap)
+    {
+        assert(RunningCount_ > 0);
+        --RunningCount_;
+
+        auto iter = Jobs_.find(_jobId);
+        assert(iter != Jobs_.end());
+
+        if (iter == Jobs_.end())
+        {
+            startJobs();
+            return;
+        }
+
+        const auto consumers = std::move(iter->second.Consumers_);
+
+        dropJob(iter);
+
+        for (const auto &consumer : consumers)
+        {
+            releaseOwner(consumer.Owner_);
+        }
+
+        startJobs();
+
+        // a consumer may ask for another decode, the pool is consistent by now
+        for (const auto &consumer : consumers)
+        {
+            // the owner may be gone with a consumer called before
+            if (consumer.Owner_ && !consumer.OwnerGuard_)
+            {
+                continue;
+            }
+
+            consumer.Consume_(_pixmap);
+        }
+    }
+
+    void ImageDecodePool::onOwnerDestroyed(QObject* _owner)
+    {
+        cancel(_owner);
+    }
+
+    void ImageDecodePool::addOwner(QObject* _owner)
+    {
+        if (!_owner)
+        {
+            return;
+        }
+
+        auto &count = Owners_[_owner];
+        if (count++ == 0)
+        {
+            QObject::connect(_owner, &QObject::destroyed, this, &ImageDecodePool::onOwnerDestroyed, Qt::DirectConnection);
+        }
+    }
+
+    void ImageDecodePool::releaseOwner(QObject* _owner)
+    {
+        if (!_owner)
+        {
+            return;
+        }
+
+        auto iter = Owners_.find(_owner);
+        if (iter == Owners_.end())
+        {
+            return;
+        }
+
+        if (--iter.value() > 0)
+        {
+            return;
+        }
+
+        Owners_.erase(iter);
+
+        QObject::disconnect(_owner, &QObject::destroyed, this, &ImageDecodePool::onOwnerDestroyed);
+    }
+
+    void ImageDecodePool::dropJob(JobMap::iterator _job)
+    {
+        const auto &key = _job->second.Key_;
+        if (!key.isEmpty())
+        {
+            JobsByKey_.remove(key);
+        }
+
+        for (const auto &consumer : _job->second.Consumers_)
+        {
+            releaseOwner(consumer.Owner_);
+        }
+
+        Jobs_.erase(_job);
+    }
+
+    DecodePriority ImageDecodePool::getEffectivePriority(const Job& _job, OnScreenMap& _onScreen) const
+    {
+        if (_job.Priority_ == DecodePriority::Visible)
+        {
+            return _job.Priority_;
+        }
+
+        for (const auto &consumer : _job.Consumers_)
+        {
+            auto iterOnScreen = _onScreen.find(consumer.Owner_);
+            if (iterOnScreen == _onScreen.end())
+            {
+                iterOnScreen = _onScreen.insert(consumer.Owner_, isOnScreen(consumer.Owner_));
+            }
+
+            if (iterOnScreen.value())
+            {
+                return DecodePriority::Visible;
+            }
+        }
+
+        return _job.Priority_;
+    }
+
+    void ImageDecodePool::startJobs()
+    {
+        if (RunningCount_ >= MaxRunningCount_)
+        {
+            return;
+        }
+
+        // the priorities are taken once per call, the visible region of a widget is not cheap
+        OnScreenMap onScreen;
+
+        std::vector<std::pair<DecodePriority, JobMap::iterator>> pending;
+
+        for (auto iter = Jobs_.begin(); iter != Jobs_.end(); ++iter)
+        {
+            if (!iter->second.IsRunning_)
+            {
+                pending.emplace_back(getEffectivePriority(iter->second, onScreen), iter);
+            }
+        }
+
+        // the jobs are kept in the order they came, the first ones of the highest priority go
+        std::stable_sort(pending.begin(), pending.end(), [](const std::pair<DecodePriority, JobMap::iterator>& _first, const std::pair<DecodePriority, JobMap::iterator>& _second)
+        {
+            return (_first.first < _second.first);
+        });
+
+        for (auto iter = pending.begin(); iter != pending.end() && RunningCount_ < MaxRunningCount_; ++iter)
+        {
+            auto &job = iter->second->second;
+            job.IsRunning_ = true;
+
+            ++RunningCount_;
+
+            Pool_.start(new DecodeTask(this, iter->second->first, job.Decoder_));
+        }
+    }
+
+    ImageDecodePool* GetImageDecodePool()
+    {
+        static std::unique_ptr<ImageDecodePool> pool(new ImageDecodePool());
+        return pool.get();
+    }
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+namespace core
+{
+    struct istream;
+}
+
+namespace Utils
+{
+    enum class DecodePriority
+    {
+        Visible,
+        NearViewport,
+        Prefetch
+    };
+
+    typedef std::function<QPixmap()> ImageDecoder;
+
+    typedef std::function<void(QPixmap)> ImageConsumer;
+
+    // the image is scaled down to fit _maxSize while decoded unless the size is invalid
+    ImageDecoder makeFileDecoder(const QString& _path, const QSize& _maxSize = QSize());
+
+    // the preview of a downloaded image is cached on disk by the path of the downloaded file
+    ImageDecoder makeDataDecoder(core::istream* _stream, const QSize& _maxSize = QSize(), const QString& _localPath = QString());
+
+    ImageDecoder makeResizeDecoder(const QPixmap& _pixmap, const QSize& _size);
+
+    // the decodes of the images shown in the gui, a few of them run at once:
+    //  - a queued image on the screen goes first, then the images near the viewport, then the prefetched ones;
+    //  - an image asked for again while it is queued or decoded is decoded once for all its consumers;
+    //  - a consumer is dropped with its owner, a queued decode nobody waits for is dropped too
+    class ImageDecodePool : public QObject
+    {
+        Q_OBJECT
+
+    public:
+        ImageDecodePool();
+
+        virtual ~ImageDecodePool();
+
+        // the decodes under an empty key are never shared, a null owner keeps the consumer for the lifetime of the pool
+        void decode(const QString& _key, const DecodePriority _priority, QObject* _owner, const ImageDecoder& _decoder, const ImageConsumer& _consumer);
+
+        void cancel(QObject* _owner);
+
+    private Q_SLOTS:
+        void onDecoded(quint64 _jobId, QPixmap _pixmap);
+
+        void onOwnerDestroyed(QObject* _owner);
+
+    private:
+        struct Consumer
+        {
+            QObject* Owner_;
+
+            QPointer<QObject> OwnerGuard_;
+
+            ImageConsumer Consume_;
+        };
+
+        struct Job
+        {
+            Job();
+
+            QString Key_;
+
+            DecodePriority Priority_;
+
+            ImageDecoder Decoder_;
+
+            std::vector<Consumer> Consumers_;
+
+            bool IsRunning_;
+        };
+
+        typedef std::map<quint64, Job> JobMap;
+
+        void addOwner(QObject* _owner);
+
+        void releaseOwner(QObject* _owner);
+
+        void dropJob(JobMap::iterator _job);
+
+        typedef QHash<const QObject*, bool> OnScreenMap;
+
+        // _onScreen keeps the visibility of the owners already checked
+        DecodePriority getEffectivePriority(const Job& _job, OnScreenMap& _onScreen) const;
+
+        void startJobs();
+
+        QThreadPool Pool_;
+
+        JobMap Jobs_;
+
+        QHash<QString, quint64> JobsByKey_;
+
+        // the number of consumers by owner
+        QHash<QObject*, int> Owners_;
+
+        quint64 NextJobId_;
+
+        int RunningCount_;
+
+        int MaxRunningCount_;
+    };
+
+    ImageDecodePool* GetImageDecodePool();
+}
@@ -5,6 +5,7 @@
 #include "launch.h"
 #include "utils.h"
 #include "log/log.h"
+#include "profiling/timeline.h"
 #include "../core_dispatcher.h"
 #include "../gui_settings.h"
 #include "../cache/emoji/Emoji.h"
@@ -163,6 +164,8 @@ namespace Utils
 #endif
 
         int res = app_->exec();
+
+        Profiling::markPhase("shutdown.gui_event_loop_finished");
 #ifdef _WIN32
 		qApp->removeNativeEventFilter(&eventFilter);
 #endif
@@ -310,6 +313,8 @@ namespace Utils
         Utils::GetTranslator()->init();
         mainWindow_.reset(new Ui::MainWindow(app_.get(), _has_valid_login));
 
+        Profiling::markPhase("gui.main_window_created");
+
         bool needToShow = true;
 #ifdef _WIN32
         for (int i = 0; i < app_->arguments().size(); ++i)
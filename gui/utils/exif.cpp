@@ -43,66 +43,49 @@ namespace
     uint16_t peekUnsignedShort(const char *buf, const bool isBigEndian);
 
     ExifOrientation searchForOrientationTag(const ExifTagInfo &exifInfo);
+
+    bool getOrientationMatrix(const ExifOrientation orientation, Out QMatrix &modelMatrix);
+}
+
+bool isExifOrientationTransposed(const ExifOrientation orientation)
+{
+    switch(orientation)
+    {
+        case ExifOrientation::Rotate90A:
+        case ExifOrientation::Rotate90AFlipX:
+        case ExifOrientation::Rotate90C:
+        case ExifOrientation::Rotate90CFlipX:
+            return true;
+
+        default:
+            return false;
+    }
 }
 
 void applyExifOrientation(const ExifOrientation orientation, InOut QPixmap &pixmap)
 {
     assert(!pixmap.isNull());
 
-    const auto isOrientationValid = (
-        (orientation > ExifOrientation::Min) &&
-        (orientation < ExifOrientation::Max));
-    if (!isOrientationValid)
+    QMatrix modelMatrix;
+    if (!getOrientationMatrix(orientation, Out modelMatrix))
     {
-        assert(!"invalid orientation value");
         return;
     }
 
-    if (orientation == ExifOrientation::Normal)
-    {
-        return;
-    }
+    pixmap = pixmap.transformed(modelMatrix);
+}
 
-    QMatrix modelMatrix;
+void applyExifOrientation(const ExifOrientation orientation, InOut QImage &image)
+{
+    assert(!image.isNull());
 
-    switch(orientation)
+    QMatrix modelMatrix;
+    if (!getOrientationMatrix(orientation, Out modelMatrix))
     {
-        case ExifOrientation::FlipX:
-            modelMatrix.scale(-1, 1);
-            break;
-
-        case ExifOrientation::FlipY:
-            modelMatrix.scale(1, -1);
-            break;
-
-        case ExifOrientation::Rotate180C:
-            modelMatrix.rotate(180);
-            break;
-
-        case ExifOrientation::Rotate90A:
-            modelMatrix.rotate(-90);
-            break;
-
-        case ExifOrientation::Rotate90AFlipX:
-            modelMatrix.rotate(-90);
-            modelMatrix.scale(-1, 1);
-            break;
-
-        case ExifOrientation::Rotate90C:
-            modelMatrix.rotate(90);
-            break;
-
-        case ExifOrientation::Rotate90CFlipX:
-            modelMatrix.rotate(90);
-            modelMatrix.scale(-1, 1);
-            break;
-
-        default:
-            assert(!"IP is not expected to be here");
-            return;
+        return;
     }
 
-    pixmap = pixmap.transformed(modelMatrix);
+    image = image.transformed(modelMatrix);
 }
 
 ExifOrientation getExifOrientation(const char *buf, const size_t bufSize)
@@ -121,6 +104,62 @@ ExifOrientation getExifOrientation(const char *buf, const size_t bufSize)
 
 namespace
 {
+    bool getOrientationMatrix(const ExifOrientation orientation, Out QMatrix &modelMatrix)
+    {
+        const auto isOrientationValid = (
+            (orientation > ExifOrientation::Min) &&
+            (orientation < ExifOrientation::Max));
+        if (!isOrientationValid)
+        {
+            assert(!"invalid orientation value");
+            return false;
+        }
+
+        if (orientation == ExifOrientation::Normal)
+        {
+            return false;
+        }
+
+        switch(orientation)
+        {
+            case ExifOrientation::FlipX:
+                modelMatrix.scale(-1, 1);
+                break;
+
+            case ExifOrientation::FlipY:
+                modelMatrix.scale(1, -1);
+                break;
+
+            case ExifOrientation::Rotate180C:
+                modelMatrix.rotate(180);
+                break;
+
+            case ExifOrientation::Rotate90A:
+                modelMatrix.rotate(-90);
+                break;
+
+            case ExifOrientation::Rotate90AFlipX:
+                modelMatrix.rotate(-90);
+                modelMatrix.scale(-1, 1);
+                break;
+
+            case ExifOrientation::Rotate90C:
+                modelMatrix.rotate(90);
+                break;
+
+            case ExifOrientation::Rotate90CFlipX:
+                modelMatrix.rotate(90);
+                modelMatrix.scale(-1, 1);
+                break;
+
+            default:
+                assert(!"IP is not expected to be here");
+                return false;
+        }
+
+        return true;
+    }
+
     ExifTagInfo::ExifTagInfo()
         : begin_(nullptr)
         , length_(0)
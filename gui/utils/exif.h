@@ -20,8 +20,12 @@ enum class ExifOrientation
     Max
 };
 
+bool isExifOrientationTransposed(const ExifOrientation orientation);
+
 void applyExifOrientation(const ExifOrientation orientation, InOut QPixmap &pixmap);
 
+void applyExifOrientation(const ExifOrientation orientation, InOut QImage &image);
+
 ExifOrientation getExifOrientation(const char *buf, const size_t bufSize);
 
 UTILS_EXIF_NS_END
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include "../types/snap.h"
 #include "../cache/snaps/SnapStorage.h"
 #include "../main_window/history_control/MessagesModel.h"
+#include "profiling/timeline.h"
 
 #ifdef ICQ_QT_STATIC
     #ifdef _WIN32
@@ -30,10 +31,12 @@
 #endif
 
 const QString urlCommand = "-urlcommand";
+const QString timelineCommand = "-timeline";
 
 launch::CommandLineParser::CommandLineParser(int _argc, char* _argv[])
 {
     isUlrCommand_ = false;
+    isTimelineDump_ = false;
 
     if (_argc <= 0)
     {
@@ -55,6 +58,10 @@ launch::CommandLineParser::CommandLineParser(int _argc, char* _argv[])
 
             urlCommand_ = _argv[i];
         }
+        else if (_argv[i] == timelineCommand)
+        {
+            isTimelineDump_ = true;
+        }
     }
 }
 
@@ -78,12 +85,19 @@ const QString& launch::CommandLineParser::getExecutable() const
     return executable_;
 }
 
+bool launch::CommandLineParser::isTimelineDump() const
+{
+    return isTimelineDump_;
+}
+
 int launch::main(int _argc, char* _argv[])
 {
     static bool isLaunched = false;
     if (isLaunched)
         return 0;
     isLaunched = true;
+
+    Profiling::markPhase("gui.main");
     
     Utils::Application app(_argc, _argv);
     
@@ -103,6 +117,12 @@ int launch::main(int _argc, char* _argv[])
 
     if (app.init())
     {
+        Profiling::markPhase("gui.core_linked");
+        Profiling::startTimeline();
+
+        if (cmd_parser.isTimelineDump())
+            Profiling::requestTimelineDump();
+
         qRegisterMetaType<Data::ImageListPtr>("Data::ImageListPtr");
         qRegisterMetaType<std::shared_ptr<Data::ContactList>>("std::shared_ptr<Data::ContactList>");
         qRegisterMetaType<std::shared_ptr<Data::MessageBuddies>>("std::shared_ptr<Data::MessageBuddies>");
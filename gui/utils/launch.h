@@ -8,6 +8,8 @@ namespace launch
 
         QString urlCommand_;
 
+        bool isTimelineDump_;
+
     public:
 
         CommandLineParser(int _argc, char* _argv[]);
@@ -19,6 +21,8 @@ namespace launch
         const QString& getUrlCommand() const;
 
         const QString& getExecutable() const;
+
+        bool isTimelineDump() const;
     };
 
     int main(int argc, char *argv[]);
@@ -0,0 +1,67 @@
+#include "stdafx.h"
+
+#include "timeline.h"
+
+#include "../../core_dispatcher.h"
+#include "../../utils/gui_coll_helper.h"
+
+namespace
+{
+    std::vector<std::pair<std::string, qint64>> pendingPhases_;
+
+    std::unordered_set<std::string> markedPhases_;
+
+    bool isStarted_ = false;
+
+    void postPhase(const std::string& _phase, const qint64 _ts)
+    {
+        Ui::gui_coll_helper collection(Ui::GetDispatcher()->create_collection(), true);
+        collection.set_value_as_string("phase", _phase);
+        collection.set_value_as_int64("ts", _ts);
+
+        Ui::GetDispatcher()->post_message_to_core("timeline/mark", collection.get());
+    }
+}
+
+namespace Profiling
+{
+    void markPhase(const char* _phase)
+    {
+        assert(_phase);
+        assert(::strlen(_phase));
+
+        if (!markedPhases_.insert(_phase).second)
+            return;
+
+        const auto ts = QDateTime::currentMSecsSinceEpoch();
+
+        if (!isStarted_)
+        {
+            pendingPhases_.emplace_back(_phase, ts);
+            return;
+        }
+
+        postPhase(_phase, ts);
+    }
+
+    void startTimeline()
+    {
+        assert(!isStarted_);
+
+        isStarted_ = true;
+
+        for (const auto& phase : pendingPhases_)
+            postPhase(phase.first, phase.second);
+
+        pendingPhases_.clear();
+    }
+
+    void requestTimelineDump()
+    {
+        assert(isStarted_);
+
+        Ui::gui_coll_helper collection(Ui::GetDispatcher()->create_collection(), true);
+
+        Ui::GetDispatcher()->post_message_to_core("timeline/dump", collection.get());
+    }
+}
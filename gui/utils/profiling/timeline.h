@@ -0,0 +1,13 @@
+#pragma once
+
+namespace Profiling
+{
+    // startup and shutdown phases of the gui, kept by the core together with its own ones;
+    // only the first mark of a phase is sent, the phases reached before the core is linked are sent by startTimeline
+    void markPhase(const char* _phase);
+
+    void startTimeline();
+
+    // the kept runs are written to the logs folder as timeline.txt on exit
+    void requestTimelineDump();
+}
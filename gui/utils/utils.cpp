@@ -51,6 +51,9 @@ namespace
     const int drag_preview_max_width = 320;
     const int drag_preview_max_height = 240;
 
+    // the exif block is at the start of the file and never takes more than 64k
+    const int exif_header_max_size = (64 * 1024);
+
 	const QColor ColorTable[] = {
 		"#FF0000",
 		"#FF7373",
@@ -249,6 +252,80 @@ namespace
     const QString read_msg_page = "https://r.mail.ru:443/cln8791/mra-mail.mail.ru/cgi-bin/readmsg?id=";
     const QString mail_open_mail_url = base_mail_url + redirect + "&page=" + read_msg_page + "%5&lang=%4" + "&FailPage=" + read_msg_page + "%5&lang=%4";
 
+    void fitImage(const QSize& _maxSize, InOut QImage& _image)
+    {
+        if ((_image.width() > _maxSize.width()) || (_image.height() > _maxSize.height()))
+        {
+            _image = _image.scaled(_maxSize, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+        }
+    }
+
+    bool readImageScaled(QIODevice& _device, const QSize& _maxSize, Out QImage& _image)
+    {
+        assert(_device.isOpen());
+
+        // only the header is read until the size to decode at is known
+        const auto header = _device.peek(exif_header_max_size);
+        if (header.isEmpty())
+        {
+            return false;
+        }
+
+        const auto orientation = Utils::Exif::getExifOrientation(header.constData(), header.size());
+
+        QImageReader reader(&_device);
+
+        const auto imageSize = reader.size();
+        if (imageSize.isValid())
+        {
+            // the image is stored before the orientation is applied
+            auto maxSize = _maxSize;
+            if (Utils::Exif::isExifOrientationTransposed(orientation))
+            {
+                maxSize.transpose();
+            }
+
+            // jpeg is scaled by the decoder itself, the other formats are decoded and then scaled by the reader
+            if ((imageSize.width() > maxSize.width()) || (imageSize.height() > maxSize.height()))
+            {
+                reader.setScaledSize(imageSize.scaled(maxSize, Qt::KeepAspectRatio));
+            }
+        }
+
+        if (!reader.read(&_image))
+        {
+            return false;
+        }
+
+        Utils::Exif::applyExifOrientation(orientation, InOut _image);
+
+        // the size may be unknown before the image is decoded
+        fitImage(_maxSize, InOut _image);
+
+        return true;
+    }
+
+    bool loadImageFullAndScale(const QByteArray& _data, const QSize& _maxSize, Out QImage& _image)
+    {
+        static const char *availableFormats[] = { "PNG", "JPG" };
+
+        for (auto fmt : availableFormats)
+        {
+            if (!_image.loadFromData(_data, fmt))
+            {
+                continue;
+            }
+
+            const auto orientation = Utils::Exif::getExifOrientation(_data.data(), _data.size());
+            Utils::Exif::applyExifOrientation(orientation, InOut _image);
+
+            fitImage(_maxSize, InOut _image);
+
+            return true;
+        }
+
+        return false;
+    }
 }
 
 namespace Utils
@@ -734,7 +811,7 @@ namespace Utils
 		return result;
 	}
 
-	QPixmap roundImage(const QPixmap& _img, const QString& _state, bool /*isDefault*/, bool _miniIcons)
+	QImage roundImage(const QImage& _img, const QString& _state, bool /*isDefault*/, bool _miniIcons)
 	{
 		int scale = std::min(_img.height(), _img.width());
 		QImage imageOut(QSize(scale, scale), QImage::Format_ARGB32);
@@ -785,7 +862,7 @@ namespace Utils
         auto addedRadius = Utils::scale_value(8);
         if (_state == "photo enter" || _state == "photo leave")
         {
-            QPixmap p(Utils::parse_image_name(":/resources/content_addphoto_100.png"));
+            QImage p(Utils::parse_image_name(":/resources/content_addphoto_100.png"));
             int x = (scale - p.width());
             int y = (scale - p.height());
             QPainterPath stPath(QPointF(0, 0));
@@ -794,7 +871,7 @@ namespace Utils
         }
 
 		painter.setClipPath(path);
-		painter.drawPixmap(0, 0, _img);
+		painter.drawImage(0, 0, _img);
 
         if (_state == "photo enter")
         {
@@ -817,32 +894,32 @@ namespace Utils
             QPainterPath stPath(QPointF(0,0));
             stPath.addRect(0, 0, scale, scale);
             painter.setClipPath(stPath);
-            QPixmap p;
+            QImage p;
             if (_state == "online_active")
-                p = QPixmap(Utils::parse_image_name(_miniIcons ? ":/resources/cl_status_online_mini_100_active.png" : ":/resources/cl_status_online_100_active.png"));
+                p = QImage(Utils::parse_image_name(_miniIcons ? ":/resources/cl_status_online_mini_100_active.png" : ":/resources/cl_status_online_100_active.png"));
             else
-                p = QPixmap(Utils::parse_image_name(_miniIcons ? ":/resources/cl_status_online_mini_100.png" : ":/resources/cl_status_online_100.png"));
+                p = QImage(Utils::parse_image_name(_miniIcons ? ":/resources/cl_status_online_mini_100.png" : ":/resources/cl_status_online_100.png"));
             int x = (scale - p.width());
             int y = (scale - p.height());
-            painter.drawPixmap(x, y, p);
+            painter.drawImage(x, y, p);
         }
         else if (_state == "mobile" || _state == "mobile_active")
         {
             QPainterPath stPath(QPointF(0,0));
             stPath.addRect(0, 0, scale, scale);
             painter.setClipPath(stPath);
-            QPixmap p;
+            QImage p;
             if (_state == "mobile")
-                p = QPixmap(Utils::parse_image_name(_miniIcons ? ":/resources/cl_status_mobile_mini_100.png" : ":/resources/cl_status_mobile_100.png"));
+                p = QImage(Utils::parse_image_name(_miniIcons ? ":/resources/cl_status_mobile_mini_100.png" : ":/resources/cl_status_mobile_100.png"));
             else
-                p = QPixmap(Utils::parse_image_name(_miniIcons ? ":/resources/cl_status_mobile_mini_100_active.png" : ":/resources/cl_status_mobile_100_active.png"));
+                p = QImage(Utils::parse_image_name(_miniIcons ? ":/resources/cl_status_mobile_mini_100_active.png" : ":/resources/cl_status_mobile_100_active.png"));
             int x = (scale - p.width());
             int y = (scale - p.height());
-            painter.drawPixmap(x, y, p);
+            painter.drawImage(x, y, p);
         }
         else if (_state == "photo enter" || _state == "photo leave")
         {
-            QPixmap p(Utils::parse_image_name(":/resources/content_addphoto_100.png"));
+            QImage p(Utils::parse_image_name(":/resources/content_addphoto_100.png"));
             int x = (scale - p.width());
             int y = (scale - p.height());
 
@@ -854,12 +931,18 @@ namespace Utils
 
     		painter.setBrush(Qt::transparent);
             painter.drawEllipse(x - addedRadius / 2, y - addedRadius / 2, p.width() + addedRadius, p.height() + addedRadius);
-            painter.drawPixmap(x, y, p);
+            painter.drawImage(x, y, p);
         }
 
-        QPixmap pixmap = QPixmap::fromImage(imageOut);
-        Utils::check_pixel_ratio(pixmap);
-		return pixmap;
+        painter.end();
+
+        Utils::check_pixel_ratio(imageOut);
+		return imageOut;
+	}
+
+	QPixmap roundImage(const QPixmap& _img, const QString& _state, bool _isDefault, bool _miniIcons)
+	{
+		return QPixmap::fromImage(roundImage(_img.toImage(), _state, _isDefault, _miniIcons));
 	}
 
     bool isValidEmailAddress(const QString& _email)
@@ -1711,6 +1794,50 @@ namespace Utils
         return false;
     }
 
+    bool loadImageScaled(const QString& _path, const QSize& _maxSize, Out QImage& _image)
+    {
+        assert(!_path.isEmpty());
+        assert(_maxSize.isValid());
+
+        QFile file(_path);
+        if (!file.open(QIODevice::ReadOnly))
+        {
+            return false;
+        }
+
+        if (readImageScaled(file, _maxSize, Out _image))
+        {
+            return true;
+        }
+
+        // the format was not told by the content, the formats we may get are tried one by one
+        file.seek(0);
+
+        const auto data = file.readAll();
+        if (data.isEmpty())
+        {
+            return false;
+        }
+
+        return loadImageFullAndScale(data, _maxSize, Out _image);
+    }
+
+    bool loadImageScaled(const QByteArray& _data, const QSize& _maxSize, Out QImage& _image)
+    {
+        assert(!_data.isEmpty());
+        assert(_maxSize.isValid());
+
+        QBuffer buffer;
+        buffer.setData(_data);
+
+        if (buffer.open(QIODevice::ReadOnly) && readImageScaled(buffer, _maxSize, Out _image))
+        {
+            return true;
+        }
+
+        return loadImageFullAndScale(_data, _maxSize, Out _image);
+    }
+
     bool dragUrl(QWidget* _parent, const QPixmap& _preview, const QString& _url)
     {
         QDrag *drag = new QDrag(_parent);
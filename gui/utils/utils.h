@@ -53,6 +53,9 @@ namespace Utils
     
     QPixmap roundImage(const QPixmap& _img, const QString& _state, bool _isDefault, bool _miniIcons);
 
+    // paints on a QImage only, may be called off the gui thread
+    QImage roundImage(const QImage& _img, const QString& _state, bool _isDefault, bool _miniIcons);
+
     void addShadowToWidget(QWidget* _target);
     void addShadowToWindow(QWidget* _target, bool _enabled = true);
 
@@ -184,6 +187,11 @@ namespace Utils
 
     bool loadPixmap(const QByteArray& _data, Out QPixmap& _pixmap);
 
+    // the image is decoded right at the size fitting _maxSize, only the header of a large image is read in full
+    bool loadImageScaled(const QString& _path, const QSize& _maxSize, Out QImage& _image);
+
+    bool loadImageScaled(const QByteArray& _data, const QSize& _maxSize, Out QImage& _image);
+
     bool dragUrl(QWidget* _parent, const QPixmap& _preview, const QString& _url);
 
     bool extractUinFromIcqLink(const QString &_uri, Out QString &_uin);
@@ -0,0 +1,719 @@
+#include "stdafx.h"
+
+#include "core/archive/archive_index.h"
+#include "core/archive/contact_archive.h"
+#include "core/archive/history_message.h"
+#include "core/archive/local_history.h"
+#include "core/archive/messages_data.h"
+#include "core/tools/strings.h"
+#include "core/tools/system.h"
+
+// generates a synthetic archive in a temporary folder and measures the archive layer on it;
+// the report is a json line on stdout, it is appended to the --out file as well so that the runs of the commits can be compared
+
+using namespace core;
+
+namespace
+{
+    const int32_t search_buffer_size = 1024 * 1024 * 10;
+
+    const uint64_t first_message_time = 1480000000;
+
+    const int64_t first_msgid = 6300000000000000000;
+
+    // the index serves the pages of this size whatever is asked
+    const int32_t page_size = 30;
+
+    struct bench_options
+    {
+        int32_t contacts_;
+
+        // per contact
+        int32_t messages_;
+
+        // the average length of a text, the texts are from a half to one and a half of it
+        int32_t message_size_;
+
+        // messages per update_history call, as the server sends them
+        int32_t block_size_;
+
+        // fetched per contact, from the newest
+        int32_t pages_;
+
+        // the share of the messages modified by a patch
+        double patch_ratio_;
+
+        // the chance of a message never downloaded, the message after it starts a hole
+        double hole_ratio_;
+
+        // the share of the texts containing the search term
+        double search_hit_ratio_;
+
+        std::string search_term_;
+
+        uint32_t seed_;
+
+        std::string dir_;
+
+        bool keep_;
+
+        std::string out_;
+
+        // the commit or the build measured
+        std::string tag_;
+
+        bench_options()
+            : contacts_(50)
+            , messages_(2000)
+            , message_size_(120)
+            , block_size_(100)
+            , pages_(10)
+            , patch_ratio_(0.05)
+            , hole_ratio_(0.01)
+            , search_hit_ratio_(0.01)
+            , search_term_("quokka")
+            , seed_(1)
+            , keep_(false)
+        {
+        }
+    };
+
+    struct measurement
+    {
+        std::string name_;
+
+        std::string unit_;
+
+        std::vector<int64_t> samples_us_;
+
+        int64_t items_;
+
+        measurement(const std::string& _name, const std::string& _unit)
+            : name_(_name)
+            , unit_(_unit)
+            , items_(0)
+        {
+        }
+    };
+
+    struct bench_results
+    {
+        // a list as the measurements are referenced while the next ones are added
+        std::list<measurement> measurements_;
+
+        int64_t archive_bytes_;
+
+        int64_t holes_expected_;
+
+        int64_t holes_found_;
+
+        int64_t search_hits_;
+
+        bench_results()
+            : archive_bytes_(0)
+            , holes_expected_(0)
+            , holes_found_(0)
+            , search_hits_(0)
+        {
+        }
+
+        measurement& add(const std::string& _name, const std::string& _unit)
+        {
+            measurements_.emplace_back(_name, _unit);
+            return measurements_.back();
+        }
+    };
+
+    struct contact_info
+    {
+        std::string aimid_;
+
+        std::vector<int64_t> msgids_;
+    };
+
+    template<class F_>
+    void measure(measurement& _measurement, const F_& _func)
+    {
+        const auto started = std::chrono::steady_clock::now();
+
+        _measurement.items_ += _func();
+
+        const auto elapsed = (std::chrono::steady_clock::now() - started);
+        _measurement.samples_us_.push_back(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+    }
+
+    void print_usage()
+    {
+        std::cerr <<
+            "usage: archive_bench [options]\n"
+            "    --contacts N          dialogs in the archive (50)\n"
+            "    --messages N          messages per dialog (2000)\n"
+            "    --message-size N      average text length (120)\n"
+            "    --block-size N        messages per update_history call (100)\n"
+            "    --pages N             pages fetched per dialog (10)\n"
+            "    --patch-ratio R       share of the messages patched (0.05)\n"
+            "    --hole-ratio R        chance of a missing message (0.01)\n"
+            "    --search-hit-ratio R  share of the texts with the term (0.01)\n"
+            "    --search-term S       the searched term (quokka)\n"
+            "    --seed N              the generator seed (1)\n"
+            "    --dir PATH            the archive folder, new or empty (a temporary one)\n"
+            "    --keep                keep the archive\n"
+            "    --out FILE            append the report to the file\n"
+            "    --tag S               the label of the run, e.g. a commit\n";
+    }
+
+    bool is_ratio(const double _value)
+    {
+        return ((_value >= 0) && (_value < 1));
+    }
+
+    bool parse_options(int _argc, char* _argv[], Out bench_options& _options)
+    {
+        for (auto i = 1; i < _argc; ++i)
+        {
+            const std::string name = _argv[i];
+
+            if (name == "--keep")
+            {
+                _options.keep_ = true;
+                continue;
+            }
+
+            if ((i + 1) >= _argc)
+                return false;
+
+            const std::string value = _argv[++i];
+
+            try
+            {
+                if (name == "--contacts")
+                    _options.contacts_ = boost::lexical_cast<int32_t>(value);
+                else if (name == "--messages")
+                    _options.messages_ = boost::lexical_cast<int32_t>(value);
+                else if (name == "--message-size")
+                    _options.message_size_ = boost::lexical_cast<int32_t>(value);
+                else if (name == "--block-size")
+                    _options.block_size_ = boost::lexical_cast<int32_t>(value);
+                else if (name == "--pages")
+                    _options.pages_ = boost::lexical_cast<int32_t>(value);
+                else if (name == "--patch-ratio")
+                    _options.patch_ratio_ = boost::lexical_cast<double>(value);
+                else if (name == "--hole-ratio")
+                    _options.hole_ratio_ = boost::lexical_cast<double>(value);
+                else if (name == "--search-hit-ratio")
+                    _options.search_hit_ratio_ = boost::lexical_cast<double>(value);
+                else if (name == "--search-term")
+                    _options.search_term_ = value;
+                else if (name == "--seed")
+                    _options.seed_ = boost::lexical_cast<uint32_t>(value);
+                else if (name == "--dir")
+                    _options.dir_ = value;
+                else if (name == "--out")
+                    _options.out_ = value;
+                else if (name == "--tag")
+                    _options.tag_ = value;
+                else
+                    return false;
+            }
+            catch (const boost::bad_lexical_cast&)
+            {
+                return false;
+            }
+        }
+
+        return (
+            (_options.contacts_ > 0) &&
+            (_options.messages_ > 0) &&
+            (_options.message_size_ > 0) &&
+            (_options.block_size_ > 0) &&
+            (_options.pages_ > 0) &&
+            is_ratio(_options.patch_ratio_) &&
+            is_ratio(_options.hole_ratio_) &&
+            is_ratio(_options.search_hit_ratio_) &&
+            !_options.search_term_.empty());
+    }
+
+    std::string make_text(std::mt19937& _random, const bench_options& _options)
+    {
+        static const char* words[] =
+        {
+            "hello", "meeting", "tomorrow", "photo", "link", "weekend", "project", "coffee",
+            "call", "later", "thanks", "review", "office", "ticket", "train", "evening"
+        };
+
+        std::uniform_int_distribution<size_t> word(0, (sizeof(words) / sizeof(words[0])) - 1);
+        std::uniform_int_distribution<int32_t> length(_options.message_size_ / 2, _options.message_size_ * 3 / 2);
+        std::bernoulli_distribution is_hit(_options.search_hit_ratio_);
+
+        const auto text_length = (size_t) std::max(length(_random), 1);
+
+        std::string text;
+        text.reserve(text_length + 16);
+
+        if (is_hit(_random))
+            text = _options.search_term_;
+
+        while (text.size() < text_length)
+        {
+            if (!text.empty())
+                text += ' ';
+
+            text += words[word(_random)];
+        }
+
+        return text;
+    }
+
+    void update_history(archive::local_history& _history, const std::string& _aimid, Out archive::history_block& _block, measurement& _measurement)
+    {
+        if (_block.empty())
+            return;
+
+        auto data = std::make_shared<archive::history_block>();
+        data->swap(_block);
+
+        measure(_measurement, [&_history, &_aimid, data]
+        {
+            archive::headers_list inserted;
+            archive::dlg_state state;
+            archive::dlg_state_changes changes;
+
+            _history.update_history(_aimid, data, Out inserted, Out state, Out changes);
+
+            return (int64_t) data->size();
+        });
+    }
+
+    void generate_contact(
+        archive::local_history& _history,
+        const bench_options& _options,
+        std::mt19937& _random,
+        contact_info& _contact,
+        measurement& _insert_measurement,
+        measurement& _patch_measurement,
+        bench_results& _results)
+    {
+        std::uniform_int_distribution<int64_t> msgid_step(1, 16);
+        std::uniform_int_distribution<uint64_t> time_step(1, 600);
+        std::bernoulli_distribution is_outgoing(0.5);
+        std::bernoulli_distribution is_missing(_options.hole_ratio_);
+
+        archive::history_block block;
+        block.reserve(_options.block_size_);
+
+        int64_t msgid = first_msgid;
+        int64_t prev_msgid = -1;
+        uint64_t time = first_message_time;
+        auto is_prev_missing = false;
+
+        while ((int32_t) _contact.msgids_.size() < _options.messages_)
+        {
+            msgid += msgid_step(_random);
+            time += time_step(_random);
+
+            // the first message is never missing, the history starts with it
+            if (!_contact.msgids_.empty() && is_missing(_random))
+            {
+                if (!is_prev_missing)
+                    ++_results.holes_expected_;
+
+                is_prev_missing = true;
+                prev_msgid = msgid;
+
+                continue;
+            }
+
+            is_prev_missing = false;
+
+            auto message = std::make_shared<archive::history_message>();
+            message->set_msgid(msgid);
+            message->set_prev_msgid(prev_msgid);
+            message->set_time(time);
+            message->set_outgoing(is_outgoing(_random));
+            message->set_text(make_text(_random, _options));
+
+            block.push_back(message);
+            _contact.msgids_.push_back(msgid);
+
+            prev_msgid = msgid;
+
+            if ((int32_t) block.size() >= _options.block_size_)
+                update_history(_history, _contact.aimid_, Out block, _insert_measurement);
+        }
+
+        update_history(_history, _contact.aimid_, Out block, _insert_measurement);
+
+        const auto patches_count = (int32_t) (_contact.msgids_.size() * _options.patch_ratio_);
+
+        std::vector<int64_t> patched(_contact.msgids_);
+        std::shuffle(patched.begin(), patched.end(), _random);
+        patched.resize(patches_count);
+        std::sort(patched.begin(), patched.end());
+
+        for (const auto patched_msgid : patched)
+        {
+            block.push_back(archive::history_message::make_modified_patch(patched_msgid));
+
+            if ((int32_t) block.size() >= _options.block_size_)
+                update_history(_history, _contact.aimid_, Out block, _patch_measurement);
+        }
+
+        update_history(_history, _contact.aimid_, Out block, _patch_measurement);
+    }
+
+    std::wstring contact_folder(const std::wstring& _dir, const std::string& _aimid)
+    {
+        auto folder = tools::from_utf8(_aimid);
+        std::replace(folder.begin(), folder.end(), L'|', L'_');
+
+        return (_dir + L"/" + folder);
+    }
+
+    int64_t folder_size(const std::wstring& _dir)
+    {
+        int64_t size = 0;
+
+        boost::system::error_code error;
+        for (boost::filesystem::recursive_directory_iterator iter(_dir, error), end; !error && iter != end; iter.increment(error))
+        {
+            if (boost::filesystem::is_regular_file(iter->status()))
+                size += (int64_t) boost::filesystem::file_size(iter->path(), error);
+        }
+
+        return size;
+    }
+
+    void generate(const std::wstring& _dir, const bench_options& _options, Out std::vector<contact_info>& _contacts, bench_results& _results)
+    {
+        std::mt19937 random(_options.seed_);
+
+        auto& insert_measurement = _results.add("update_history", "messages");
+        auto& patch_measurement = _results.add("update_history_patches", "messages");
+
+        archive::local_history history(_dir);
+
+        _contacts.resize(_options.contacts_);
+
+        for (auto i = 0; i < _options.contacts_; ++i)
+        {
+            auto& contact = _contacts[i];
+            contact.aimid_ = ("archive_bench_" + std::to_string(i));
+
+            generate_contact(history, _options, random, contact, insert_measurement, patch_measurement, _results);
+        }
+
+        history.flush_dlg_states();
+
+        _results.archive_bytes_ = folder_size(_dir);
+    }
+
+    void bench_index_load(const std::wstring& _dir, const std::vector<contact_info>& _contacts, bench_results& _results)
+    {
+        auto& index_measurement = _results.add("index_load", "messages");
+
+        for (const auto& contact : _contacts)
+        {
+            const auto file_name = (contact_folder(_dir, contact.aimid_) + L"/" + archive::index_filename());
+
+            measure(index_measurement, [&file_name, &contact]
+            {
+                archive::archive_index index(file_name);
+                index.load_from_local();
+
+                return (int64_t) contact.msgids_.size();
+            });
+        }
+    }
+
+    void bench_page_fetch(archive::local_history& _history, const bench_options& _options, const std::vector<contact_info>& _contacts, bench_results& _results)
+    {
+        // the first page of a dialog loads its index as well
+        auto& cold_measurement = _results.add("page_fetch_cold", "messages");
+        auto& page_measurement = _results.add("page_fetch", "messages");
+
+        for (const auto& contact : _contacts)
+        {
+            int64_t from = -1;
+
+            for (auto page = 0; page < _options.pages_; ++page)
+            {
+                auto messages = std::make_shared<archive::history_block>();
+
+                measure((page == 0 ? cold_measurement : page_measurement), [&_history, &contact, from, messages]
+                {
+                    _history.get_messages(contact.aimid_, from, page_size, 0, messages);
+
+                    return (int64_t) messages->size();
+                });
+
+                if (messages->empty())
+                    break;
+
+                for (const auto& message : *messages)
+                {
+                    if (from == -1 || message->get_msgid() < from)
+                        from = message->get_msgid();
+                }
+            }
+        }
+    }
+
+    void bench_holes(archive::local_history& _history, const std::vector<contact_info>& _contacts, bench_results& _results)
+    {
+        auto& holes_measurement = _results.add("hole_detection", "holes");
+
+        for (const auto& contact : _contacts)
+        {
+            int64_t from = -1;
+
+            for (;;)
+            {
+                std::shared_ptr<archive::archive_hole> hole;
+
+                measure(holes_measurement, [&_history, &contact, from, &hole]
+                {
+                    hole = _history.get_next_hole(contact.aimid_, from);
+
+                    return (int64_t) ((hole && hole->has_from()) ? 1 : 0);
+                });
+
+                if (!hole || !hole->has_from())
+                    break;
+
+                ++_results.holes_found_;
+
+                if (!hole->has_to())
+                    break;
+
+                from = hole->get_to();
+            }
+        }
+    }
+
+    void bench_search(archive::local_history& _history, const bench_options& _options, const std::vector<contact_info>& _contacts, bench_results& _results)
+    {
+        auto& search_measurement = _results.add("search", "bytes");
+
+        auto cterm = std::make_shared<archive::coded_term>();
+        cterm->lower_term = tools::system::to_lower(_options.search_term_);
+        cterm->coded_string = tools::convert_string_to_vector(_options.search_term_, std::make_shared<int32_t>(0), cterm->symbs, cterm->symb_indexes, cterm->symb_table);
+        cterm->prefix = tools::build_prefix(cterm->coded_string);
+
+        auto data = std::make_shared<tools::binary_stream>();
+        data->reserve(search_buffer_size);
+
+        // the dialogs are read into the buffer one after another as the search of the client does,
+        // a dialog which does not fit into the rest of the buffer is searched in part
+        size_t next_contact = 0;
+
+        while (next_contact < _contacts.size())
+        {
+            measure(search_measurement, [&]
+            {
+                auto contacts = std::make_shared<archive::contact_and_offsets>();
+                auto archive = std::make_shared<archive::contact_and_msgs>();
+                auto remaining_size = std::make_shared<int64_t>(search_buffer_size);
+                int64_t cur_index = 0;
+
+                data->reset();
+
+                while ((*remaining_size > 0) && (next_contact < _contacts.size()))
+                {
+                    const auto& aimid = _contacts[next_contact++].aimid_;
+
+                    auto offset = std::make_shared<int64_t>(0);
+                    auto mode = std::make_shared<int64_t>(1);
+
+                    const auto prev_index = cur_index;
+                    _history.get_history_file(aimid, *data, offset, remaining_size, cur_index, mode);
+
+                    contacts->push_back(std::make_pair(std::make_pair(aimid, mode), offset));
+                    archive->push_back(std::make_pair(aimid, prev_index));
+                }
+
+                archive->push_back(std::make_pair(std::string(), cur_index));
+
+                std::vector<std::shared_ptr<archive::searched_msg>> found;
+                archive::messages_data::search_in_archive(contacts, cterm, archive, data, found, -1);
+
+                _results.search_hits_ += (int64_t) found.size();
+
+                return cur_index;
+            });
+        }
+    }
+
+    int64_t percentile(std::vector<int64_t> _samples, const double _share)
+    {
+        if (_samples.empty())
+            return 0;
+
+        const auto index = (size_t) ((_samples.size() - 1) * _share);
+
+        std::nth_element(_samples.begin(), _samples.begin() + index, _samples.end());
+
+        return _samples[index];
+    }
+
+    std::string make_report(const bench_options& _options, const bench_results& _results)
+    {
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+
+        writer.StartObject();
+
+        writer.Key("tag");
+        writer.String(_options.tag_);
+
+        writer.Key("time");
+        writer.Int64(std::chrono::system_clock::to_time_t(std::chrono::system_clock::now()));
+
+        writer.Key("config");
+        writer.StartObject();
+        writer.Key("contacts");
+        writer.Int(_options.contacts_);
+        writer.Key("messages");
+        writer.Int(_options.messages_);
+        writer.Key("message_size");
+        writer.Int(_options.message_size_);
+        writer.Key("block_size");
+        writer.Int(_options.block_size_);
+        writer.Key("page_size");
+        writer.Int(page_size);
+        writer.Key("pages");
+        writer.Int(_options.pages_);
+        writer.Key("patch_ratio");
+        writer.Double(_options.patch_ratio_);
+        writer.Key("hole_ratio");
+        writer.Double(_options.hole_ratio_);
+        writer.Key("search_hit_ratio");
+        writer.Double(_options.search_hit_ratio_);
+        writer.Key("seed");
+        writer.Uint(_options.seed_);
+        writer.EndObject();
+
+        writer.Key("archive_bytes");
+        writer.Int64(_results.archive_bytes_);
+        writer.Key("holes_expected");
+        writer.Int64(_results.holes_expected_);
+        writer.Key("holes_found");
+        writer.Int64(_results.holes_found_);
+        writer.Key("search_hits");
+        writer.Int64(_results.search_hits_);
+
+        writer.Key("results");
+        writer.StartArray();
+
+        for (const auto& result : _results.measurements_)
+        {
+            const auto total_us = std::accumulate(result.samples_us_.begin(), result.samples_us_.end(), (int64_t) 0);
+            const auto count = (int64_t) result.samples_us_.size();
+
+            writer.StartObject();
+            writer.Key("name");
+            writer.String(result.name_);
+            writer.Key("calls");
+            writer.Int64(count);
+            writer.Key("items");
+            writer.Int64(result.items_);
+            writer.Key("unit");
+            writer.String(result.unit_);
+            writer.Key("total_ms");
+            writer.Double(total_us / 1000.0);
+            writer.Key("mean_us");
+            writer.Int64(count ? (total_us / count) : 0);
+            writer.Key("p50_us");
+            writer.Int64(percentile(result.samples_us_, 0.5));
+            writer.Key("p95_us");
+            writer.Int64(percentile(result.samples_us_, 0.95));
+            writer.Key("max_us");
+            writer.Int64(result.samples_us_.empty() ? 0 : *std::max_element(result.samples_us_.begin(), result.samples_us_.end()));
+            writer.Key("items_per_sec");
+            writer.Double(total_us ? (result.items_ * 1000000.0 / total_us) : 0);
+            writer.EndObject();
+        }
+
+        writer.EndArray();
+
+        writer.EndObject();
+
+        return buffer.GetString();
+    }
+}
+
+int main(int _argc, char* _argv[])
+{
+    bench_options options;
+    if (!parse_options(_argc, _argv, Out options))
+    {
+        print_usage();
+        return 1;
+    }
+
+    const auto dir = (options.dir_.empty() ?
+        (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path(L"icq_archive_bench_%%%%%%%%")).wstring() :
+        tools::from_utf8(options.dir_));
+
+    // the folder is removed at the end, so it must not hold anything but the bench archive
+    {
+        boost::system::error_code error;
+        if (boost::filesystem::exists(dir, error) && !boost::filesystem::is_empty(dir, error))
+        {
+            std::cerr << "the archive folder is not empty\n";
+            return 1;
+        }
+    }
+
+    if (!tools::system::create_directory(dir))
+    {
+        std::cerr << "cannot create the archive folder\n";
+        return 1;
+    }
+
+    bench_results results;
+    std::vector<contact_info> contacts;
+
+    std::cerr << "generating " << options.contacts_ << " dialogs of " << options.messages_ << " messages\n";
+    generate(dir, options, Out contacts, results);
+
+    std::cerr << "loading the indexes\n";
+    bench_index_load(dir, contacts, results);
+
+    {
+        // a fresh history so that the first pages load the archives from the disk
+        archive::local_history history(dir);
+
+        std::cerr << "fetching the pages\n";
+        bench_page_fetch(history, options, contacts, results);
+
+        std::cerr << "looking for the holes\n";
+        bench_holes(history, contacts, results);
+
+        std::cerr << "searching\n";
+        bench_search(history, options, contacts, results);
+    }
+
+    const auto report = make_report(options, results);
+
+    std::cout << report << std::endl;
+
+    if (!options.out_.empty())
+    {
+        boost::filesystem::ofstream out(tools::from_utf8(options.out_), std::ios::app);
+        out << report << '\n';
+    }
+
+    if (!options.keep_)
+    {
+        boost::system::error_code error;
+        boost::filesystem::remove_all(dir, error);
+    }
+
+    if (results.holes_found_ != results.holes_expected_)
+    {
+        std::cerr << "found " << results.holes_found_ << " holes of " << results.holes_expected_ << "\n";
+        return 2;
+    }
+
+    return 0;
+}
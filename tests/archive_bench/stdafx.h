@@ -0,0 +1,8 @@
+#pragma once
+
+// the archive code is built against the precompiled header of the core
+#include "core/stdafx.h"
+
+#include <iostream>
+#include <numeric>
+#include <random>
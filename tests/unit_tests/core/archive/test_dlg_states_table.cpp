@@ -0,0 +1,107 @@
+#include <boost/test/unit_test.hpp>
+
+// the archive headers expect the core precompiled header
+#include <core/stdafx.h>
+#include <core/archive/dlg_state.h>
+
+namespace
+{
+    struct temp_folder
+    {
+        boost::filesystem::path path_;
+
+        temp_folder()
+            : path_(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("icq_dlg_states_%%%%%%%%"))
+        {
+            boost::filesystem::create_directories(path_);
+        }
+
+        ~temp_folder()
+        {
+            boost::system::error_code error;
+            boost::filesystem::remove_all(path_, error);
+        }
+
+        std::wstring file_name() const
+        {
+            return (path_ / L"_dlg_states").wstring();
+        }
+    };
+
+    core::archive::dlg_state make_state(int64_t _last_msgid, const std::string& _friendly)
+    {
+        core::archive::dlg_state state;
+        state.set_last_msgid(_last_msgid);
+        state.set_del_up_to(_last_msgid / 2);
+        state.set_friendly(_friendly);
+
+        return state;
+    }
+
+    void check_state(core::archive::dlg_states_table& _table, const std::string& _contact, int64_t _last_msgid, const std::string& _friendly)
+    {
+        const auto state = _table.find_state(_contact);
+
+        BOOST_REQUIRE(state);
+        BOOST_CHECK_EQUAL(_last_msgid, state->get_last_msgid());
+        BOOST_CHECK_EQUAL(_last_msgid / 2, state->get_del_up_to());
+        BOOST_CHECK_EQUAL(_friendly, state->get_friendly());
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(core)
+
+BOOST_AUTO_TEST_SUITE(archive)
+
+BOOST_AUTO_TEST_SUITE(test_dlg_states_table)
+
+BOOST_AUTO_TEST_CASE(test_append_and_load)
+{
+    temp_folder folder;
+
+    {
+        core::archive::dlg_states_table table(folder.file_name());
+        table.set_state("alice", make_state(10, "Alice"));
+        table.set_state("bob", make_state(20, "Bob"));
+        BOOST_CHECK(table.flush());
+
+        table.set_state("alice", make_state(30, "Alice L."));
+        BOOST_CHECK(table.flush());
+    }
+
+    core::archive::dlg_states_table table(folder.file_name());
+    check_state(table, "alice", 30, "Alice L.");
+    check_state(table, "bob", 20, "Bob");
+    BOOST_CHECK(!table.find_state("carol"));
+}
+
+BOOST_AUTO_TEST_CASE(test_compact_and_load)
+{
+    temp_folder folder;
+
+    const int64_t updates_count = 1500;
+
+    {
+        core::archive::dlg_states_table table(folder.file_name());
+        table.set_state("bob", make_state(20, "Bob"));
+
+        // enough outdated records of one contact to rewrite the file
+        for (int64_t i = 1; i <= updates_count; ++i)
+        {
+            table.set_state("alice", make_state(i, "Alice"));
+            BOOST_REQUIRE(table.flush());
+        }
+    }
+
+    BOOST_CHECK(!boost::filesystem::exists(folder.file_name() + L".tmp"));
+
+    core::archive::dlg_states_table table(folder.file_name());
+    check_state(table, "alice", updates_count, "Alice");
+    check_state(table, "bob", 20, "Bob");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
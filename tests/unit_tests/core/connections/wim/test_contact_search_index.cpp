@@ -0,0 +1,141 @@
+#include <boost/test/unit_test.hpp>
+
+#include <core/stdafx.h>
+#include <core/connections/wim/contact_search_index.h>
+
+namespace
+{
+    // the aimids of the candidates which words really contain _pattern, like the contact list checks them
+    std::vector<std::string> search(const core::wim::contact_search_index& _index, const std::string& _pattern)
+    {
+        std::vector<std::string> result;
+
+        for (auto slot : _index.find_candidates(_pattern))
+        {
+            const auto& entry = _index.get_entry(slot);
+
+            for (const auto& word : entry.words_)
+            {
+                if (word.find(_pattern) != std::string::npos)
+                {
+                    result.push_back(entry.aimid_);
+                    break;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    void check_search(const core::wim::contact_search_index& _index, const std::string& _pattern, const std::vector<std::string>& _expected)
+    {
+        const auto found = search(_index, _pattern);
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(found.begin(), found.end(), _expected.begin(), _expected.end());
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(core)
+
+BOOST_AUTO_TEST_SUITE(wim)
+
+BOOST_AUTO_TEST_SUITE(test_contact_search_index)
+
+BOOST_AUTO_TEST_CASE(test_search)
+{
+    core::wim::contact_search_index index;
+
+    index.update("100", "John Smith", "Johnny");
+    index.update("200", "Anna Smith", "");
+    index.update("300", "Peter", "Pete");
+
+    BOOST_CHECK_EQUAL(index.size(), 3);
+
+    check_search(index, "SMITH", { "100", "200" });
+    check_search(index, "JOHNNY", { "100" });
+    check_search(index, "30", { "300" });
+
+    BOOST_CHECK(search(index, "MARY").empty());
+
+    // a single symbol has no bigrams, every contact is a candidate
+    BOOST_CHECK_EQUAL(index.find_candidates("P").size(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(test_rename)
+{
+    core::wim::contact_search_index index;
+
+    index.update("100", "John Smith", "");
+    index.update("200", "Anna Smith", "");
+
+    index.update("100", "Mary Brown", "");
+
+    BOOST_CHECK_EQUAL(index.size(), 2);
+
+    BOOST_CHECK(search(index, "JOHN").empty());
+
+    check_search(index, "SMITH", { "200" });
+    check_search(index, "BROWN", { "100" });
+
+    // the same names again leave the index as it is
+    index.update("100", "Mary Brown", "");
+    BOOST_CHECK_EQUAL(search(index, "BROWN").size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_remove)
+{
+    core::wim::contact_search_index index;
+
+    index.update("100", "John Smith", "");
+    index.update("200", "Anna Smith", "");
+
+    index.remove("100");
+    index.remove("unknown");
+
+    BOOST_CHECK_EQUAL(index.size(), 1);
+
+    BOOST_CHECK(search(index, "JOHN").empty());
+
+    check_search(index, "SMITH", { "200" });
+
+    // the contact added next takes the free slot
+    index.update("300", "Jane Smith", "");
+
+    BOOST_CHECK_EQUAL(index.size(), 2);
+    BOOST_CHECK(search(index, "JOHN").empty());
+
+    check_search(index, "SMITH", { "200", "300" });
+
+    index.remove("200");
+    index.remove("300");
+
+    BOOST_CHECK_EQUAL(index.size(), 0);
+    BOOST_CHECK(index.find_candidates("SMITH").empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_translit_patterns)
+{
+    core::wim::contact_search_index index;
+
+    index.update("100", "Ivan", "");
+    index.update("200", "Yvonne", "");
+
+    // the second symbol may be spelled 'V' or 'W'
+    core::wim::contact_search_index::patterns_list patterns;
+    patterns.push_back({ "I" });
+    patterns.push_back({ "V", "W" });
+
+    const auto candidates = index.find_candidates(patterns, 0);
+    BOOST_REQUIRE_EQUAL(candidates.size(), 1);
+    BOOST_CHECK_EQUAL(index.get_entry(candidates.front()).aimid_, "100");
+
+    index.update("200", "Iwona", "");
+
+    BOOST_CHECK_EQUAL(index.find_candidates(patterns, 0).size(), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()